@@ -3,6 +3,7 @@
 
 #include "catch.hpp"
 #include <tableprinter/tableprinter.hpp>
+#include <tableprinter/reader.hpp>
 #include <random>
 #include <algorithm>
 #include <array>
@@ -42,6 +43,42 @@ TEST_CASE( "Single float benchmark" , "[printer]" )
         return printer_output.tellp();
     };
 
+    std::stringstream rendered_output;
+
+    printer rendering_p
+    {
+        { {} } ,
+        rendered_output
+    };
+
+    rendering_p.render_once();
+
+    BENCHMARK( "Printer render_once output bench" )
+    {
+        rendering_p.print( floats[ i++ % 2048 ] );
+
+        return rendered_output.tellp();
+    };
+
+    BENCHMARK( "Printer render_once 2048 floats with print bench" )
+    {
+        rendered_output.str( {} );
+
+        for ( float f : floats )
+            rendering_p.print( f );
+
+        return rendered_output.tellp();
+    };
+
+    BENCHMARK( "Printer render_once 2048 floats with print_columns bench" )
+    {
+        rendered_output.str( {} );
+
+        rendering_p.print_columns( floats );
+
+        return rendered_output.tellp();
+    };
+
     std::stringstream raw_output;
 
     BENCHMARK( "Raw output bench" )
@@ -50,6 +87,128 @@ TEST_CASE( "Single float benchmark" , "[printer]" )
     };
 }
 
+TEST_CASE( "Integer columns benchmark" , "[printer]" )
+{
+    using namespace tableprinter;
+
+    std::array<int , 2048> ids;
+    std::array<long long , 2048> ranks;
+
+    std::random_device rd;
+    std::mt19937 gen { rd() };
+    std::uniform_int_distribution<long long> dist { -99999999999 , 99999999999 };
+
+    for ( std::size_t i = 0; i < std::size( ids ); ++i )
+    {
+        ids[ i ]   = int( dist( gen ) % 1000000 );
+        ranks[ i ] = dist( gen );
+    }
+
+    std::stringstream printer_output;
+
+    printer p
+    {
+        {
+            { name { "id" } , width { 8 } , hex {} } ,
+            { name { "rank" } , width { 14 } , decimal {} }
+        } ,
+        printer_output
+    };
+
+    p.render_once();
+
+    BENCHMARK( "Printer render_once 2048 rows bench" )
+    {
+        printer_output.str( {} );
+
+        p.print_columns( ids , ranks );
+
+        return printer_output.tellp();
+    };
+
+    std::stringstream raw_output;
+
+    BENCHMARK( "Raw output 2048 rows bench" )
+    {
+        raw_output.str( {} );
+
+        for ( std::size_t i = 0; i < std::size( ids ); ++i )
+            raw_output << std::setw( 8 ) << std::hex << ids[ i ]
+                       << std::setw( 14 ) << std::dec << ranks[ i ] << '\n';
+
+        return raw_output.tellp();
+    };
+}
+
+TEST_CASE( "Fixed floats benchmark" , "[printer]" )
+{
+    using namespace tableprinter;
+
+    std::array<double , 2048> values;
+
+    std::random_device rd;
+    std::mt19937 gen { rd() };
+    std::uniform_real_distribution<double> dist { 0.0 , 1000.0 };
+
+    std::generate_n(
+        std::begin( values ) ,
+        std::size( values ) ,
+        [ &gen , &dist ](){
+            return dist( gen );
+        }
+    );
+
+    std::vector<column> columns;
+
+    for ( int i = 0; i < 8; ++i )
+        columns.push_back( { width { 7 } , fixed { } , precision { 2 } } );
+
+    std::stringstream stream_output;
+    printer stream_p { columns , stream_output };
+
+    std::stringstream rendered_output;
+    printer rendering_p { columns , rendered_output };
+
+    rendering_p.render_once();
+
+    int i = 0;
+
+    auto print = [ &values , &i ]( printer& p )
+    {
+        const double* v = &values[ ( i++ * 8 ) % 2048 ];
+
+        p.print( v[ 0 ] , v[ 1 ] , v[ 2 ] , v[ 3 ] , v[ 4 ] , v[ 5 ] , v[ 6 ] , v[ 7 ] );
+    };
+
+    BENCHMARK( "Printer output bench" )
+    {
+        print( stream_p );
+
+        return stream_output.tellp();
+    };
+
+    BENCHMARK( "Printer render_once output bench" )
+    {
+        print( rendering_p );
+
+        return rendered_output.tellp();
+    };
+
+    std::stringstream raw_output;
+
+    BENCHMARK( "Raw output bench" )
+    {
+        const double* v = &values[ ( i++ * 8 ) % 2048 ];
+
+        for ( int col = 0; col < 8; ++col )
+            raw_output << std::setw( 7 ) << std::fixed << std::setprecision( 2 ) << v[ col ];
+
+        raw_output << '\n';
+
+        return raw_output.tellp();
+    };
+}
+
 TEST_CASE( "3 fields benchmark" , "[printer]" )
 {
     using namespace tableprinter;
@@ -121,6 +280,86 @@ TEST_CASE( "3 fields benchmark" , "[printer]" )
         return printer_output.tellp();
     };
 
+    std::stringstream rendered_output;
+
+    printer rendering_p
+    {
+        {
+            { name { "x" } , width { 8 } , fixed {} , precision { 3 } } ,
+            { name { "y" } , width { 6 } , fixed {} , precision { 2 } } ,
+            { name { "x" } , width { 16 } }
+        } ,
+        rendered_output
+    };
+
+    rendering_p.render_once();
+
+    BENCHMARK( "Printer render_once output bench" )
+    {
+        const point& po = points[ i++ % 2048 ];
+        rendering_p.print( po.x , po.y , po.str );
+
+        return rendered_output.tellp();
+    };
+
+    std::stringstream static_output;
+
+    static_printer<
+        static_column<static_width<8> , fixed , static_precision<3>> ,
+        static_column<static_width<6> , fixed , static_precision<2>> ,
+        static_column<static_width<16>>
+    > static_p { static_output };
+
+    BENCHMARK( "Static printer output bench" )
+    {
+        const point& po = points[ i++ % 2048 ];
+        static_p.print( po.x , po.y , po.str );
+
+        return static_output.tellp();
+    };
+
+    std::stringstream batch_output;
+
+    printer batch_p
+    {
+        {
+            { name { "x" } , width { 8 } , fixed {} , precision { 3 } } ,
+            { name { "y" } , width { 6 } , fixed {} , precision { 2 } } ,
+            { name { "x" } , width { 16 } }
+        } ,
+        batch_output
+    };
+
+    batch_p.render_once();
+
+    BENCHMARK( "Printer render_once 2048 rows with print bench" )
+    {
+        batch_output.str( {} );
+
+        for ( const point& po : points )
+            batch_p.print( po.x , po.y , po.str );
+
+        return batch_output.tellp();
+    };
+
+    BENCHMARK( "Printer render_once 2048 rows with print_rows bench" )
+    {
+        batch_output.str( {} );
+
+        batch_p.print_rows( points , &point::x , &point::y , &point::str );
+
+        return batch_output.tellp();
+    };
+
+    BENCHMARK( "Printer 2048 rows with print_table bench" )
+    {
+        batch_output.str( {} );
+
+        batch_p.print_table( points , &point::x , &point::y , &point::str );
+
+        return batch_output.tellp();
+    };
+
     std::stringstream raw_output;
 
     BENCHMARK( "Raw output bench" )
@@ -133,4 +372,101 @@ TEST_CASE( "3 fields benchmark" , "[printer]" )
 
         return raw_output.tellp();
     };
+}
+
+TEST_CASE( "Reading benchmark" , "[reader]" )
+{
+    using namespace tableprinter;
+
+    const std::vector<column> fixed_columns
+    {
+        { name { "id" }    , width { 8 } , hex {} } ,
+        { name { "name" }  , width { 12 } } ,
+        { name { "rank" }  , width { 6 } , decimal {} } ,
+        { name { "score" } , width { 10 } , fixed {} , precision { 2 } }
+    };
+
+    const std::vector<column> free_columns
+    {
+        { name { "id" } , hex {} } ,
+        { name { "name" } } ,
+        { name { "rank" } , decimal {} } ,
+        { name { "score" } , fixed {} , precision { 2 } }
+    };
+
+    std::mt19937 gen { 42 };
+    std::uniform_int_distribution<int> dist { 0 , 99999 };
+
+    std::stringstream output;
+
+    printer p { fixed_columns , output };
+
+    for ( int i = 0; i < 2048; ++i )
+        p.print( i , "name" + std::to_string( dist( gen ) ) , dist( gen ) % 100 , dist( gen ) / 7.0 );
+
+    const auto text { output.str() };
+
+    BENCHMARK( "Reader fixed width 2048 rows bench" )
+    {
+        double sum {};
+
+        for ( const auto& row : reader { fixed_columns , text } )
+            sum += row.get<double>( 3 );
+
+        return sum;
+    };
+
+    BENCHMARK( "Reader whitespace split 2048 rows bench" )
+    {
+        double sum {};
+
+        for ( const auto& row : reader { free_columns , text } )
+            sum += row.get<double>( 3 );
+
+        return sum;
+    };
+
+    BENCHMARK( "Reader read_columns 2048 rows bench" )
+    {
+        return std::get<3>( reader { fixed_columns , text }.read_columns<int , std::string , int , double>( 1 ) ).size();
+    };
+
+    const auto rows { reader { fixed_columns , text }.read_rows<int , std::string , int , double>( 1 ) };
+    const auto columns { reader { fixed_columns , text }.read_columns<int , std::string , int , double>( 1 ) };
+    const auto& scores { std::get<3>( columns ) };
+
+    BENCHMARK( "Summarize scores of rows bench" )
+    {
+        auto min { std::numeric_limits<double>::max() } , max { std::numeric_limits<double>::lowest() } , sum { 0.0 };
+
+        for ( const auto& row : rows )
+        {
+            min  = std::min( min , std::get<3>( row ) );
+            max  = std::max( max , std::get<3>( row ) );
+            sum += std::get<3>( row );
+        }
+
+        return min + max + sum;
+    };
+
+    BENCHMARK( "Summarize scores column bench" )
+    {
+        const auto summary { summarize( scores ) };
+
+        return summary.min + summary.max + summary.sum;
+    };
+
+    BENCHMARK( "Raw input 2048 rows bench" )
+    {
+        std::istringstream input { text };
+
+        int id , rank;
+        std::string name;
+        double score , sum {};
+
+        while ( input >> std::hex >> id >> name >> std::dec >> rank >> score )
+            sum += score;
+
+        return sum;
+    };
 }
\ No newline at end of file
@@ -1,28 +1,36 @@
-#include <fstream>
 #include <iostream>
-#include <iterator>
 #include <vector>
 #include <algorithm>
 #include <string>
+#include <tableprinter/reader.hpp>
 
-struct entry
-{
-    int         id;
-    std::string name;
-    std::string surname;
-    int         rank;
-    float       score;
-};
-
-std::istream& operator>>( std::istream& is , entry& s );
-void skip_echo_and_header( std::istream& is );
-void print_max_score( const std::vector<entry>& );
+void print_max_score(
+    const tableprinter::string_column& names ,
+    const tableprinter::string_column& surnames ,
+    const std::vector<float>& scores
+);
 
 int main()
 {
-    std::ifstream scores_f { "scores.txt" };
+    using namespace tableprinter;
+
+    // The same columns 'print-scores' prints with
+    const std::vector<column> columns
+    {
+        { name { "id" }      , width { 4 }  , hex {} } ,
+        { name { "name" }    , width { 8 } } ,
+        { name { "surname" } , width { 10 } } ,
+        { name { "rank" }    , width { 6 } , decimal {} } ,
+        { name { "score" }   , width { 7 } , fixed { } , precision { 2 } }
+    };
+
+    mapped_file scores_f;
 
-    if ( !scores_f )
+    try
+    {
+        scores_f = mapped_file { "scores.txt" };
+    }
+    catch ( const file_could_not_be_read& )
     {
         std::cerr << "'scores.txt' could not be read.\n"
                      "Run 'print-scores' first."
@@ -36,49 +44,43 @@ int main()
                  "convenient to be read"
               << std::endl;
 
-    skip_echo_and_header( scores_f );
+    reader scores_r { columns , std::move( scores_f ) };
 
-    std::istream_iterator<entry> scores_i_itr { scores_f };
-    std::istream_iterator<entry> eof;
+    // Every column lands in a contiguous vector of its own
+    const auto [ ids , names , surnames , ranks , scores ] =
+        scores_r.skip_headers()
+                .read_columns<int , std::string , std::string , int , float>();
 
-    std::vector<entry> scores { scores_i_itr , eof };
+    print_max_score( names , surnames , scores );
 
-    print_max_score( scores );
-}
-
-std::istream& operator>>( std::istream& is , entry& s )
-{
-    return is >> s.id
-              >> s.name
-              >> s.surname
-              >> s.rank
-              >> s.score;
-}
+    const auto summary { summarize( scores ) };
 
-void skip_echo_and_header( std::istream& is )
-{
-    std::string skipped_line;
-    std::getline( is , skipped_line );
-    std::getline( is , skipped_line );
+    std::cout << summary.count
+              << " scores range from "
+              << summary.min
+              << " to "
+              << summary.max
+              << " with an average of "
+              << summary.sum / summary.count
+              << std::endl;
 }
 
-void print_max_score( const std::vector<entry>& scores )
+void print_max_score(
+    const tableprinter::string_column& names ,
+    const tableprinter::string_column& surnames ,
+    const std::vector<float>& scores
+)
 {
-    auto by_score = []( const entry& lhs , const entry& rhs ){
-        return lhs.score < rhs.score;
-    };
-
-    auto winner = max_element(
+    auto winner = std::size_t( max_element(
         begin( scores ) ,
-        end( scores ) ,
-        by_score
-    );
+        end( scores )
+    ) - begin( scores ) );
 
     std::cout << "Winner is "
-              << winner->name
+              << names[ winner ]
               << " "
-              << winner->surname
+              << surnames[ winner ]
               << " who has score "
-              << winner->score
+              << scores[ winner ]
               << std::endl;
 }
\ No newline at end of file
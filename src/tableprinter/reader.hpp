@@ -0,0 +1,1406 @@
+#pragma once
+
+#include <tableprinter/tableprinter.hpp>
+
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#ifdef TABLEPRINTER_POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace tableprinter
+{
+
+struct reader_exception : ::std::runtime_error
+{
+    using ::std::runtime_error::runtime_error;
+};
+
+struct file_could_not_be_read : reader_exception
+{
+    using reader_exception::reader_exception;
+};
+
+struct header_not_found : reader_exception
+{
+    using reader_exception::reader_exception;
+};
+
+struct fields_size_doesnt_match_with_columns : reader_exception
+{
+    using reader_exception::reader_exception;
+};
+
+struct invalid_field : reader_exception
+{
+    using reader_exception::reader_exception;
+};
+
+// A read-only view of a whole file. It is memory mapped on POSIX systems, so
+// opening even a huge file costs neither a copy nor an allocation, and it is
+// read into memory at once elsewhere.
+class mapped_file
+{
+public:
+
+    mapped_file() = default;
+
+    inline explicit mapped_file( const char* path );
+    inline mapped_file( mapped_file&& ) noexcept;
+    inline mapped_file& operator=( mapped_file&& ) noexcept;
+    inline ~mapped_file();
+
+    mapped_file( const mapped_file& ) = delete;
+    mapped_file& operator=( const mapped_file& ) = delete;
+
+    ::std::string_view view() const noexcept
+    {
+        return { m_data , m_size };
+    }
+
+private:
+
+    inline void release() noexcept;
+
+    const char*                 m_data {};
+    ::std::size_t               m_size {};
+#ifndef TABLEPRINTER_POSIX
+    ::std::unique_ptr<char[]>   m_contents;
+#endif
+};
+
+namespace detail
+{
+
+constexpr bool is_blank( char c ) noexcept
+{
+    return c == ' ' || ( c >= '\t' && c <= '\r' );
+}
+
+// Splits the line into its whitespace separated fields.
+template<typename Fields>
+inline void split_fields( ::std::string_view line , Fields& fields )
+{
+    fields.clear();
+
+    const auto last { line.data() + line.size() };
+
+    for ( auto it { line.data() }; it != last; )
+    {
+        if ( is_blank( *it ) )
+        {
+            ++it;
+
+            continue;
+        }
+
+        const auto first { it };
+
+        while ( it != last && !is_blank( *it ) )
+            ++it;
+
+        fields.emplace_back( first , ::std::size_t( it - first ) );
+    }
+}
+
+#ifdef TABLEPRINTER_SSE2
+
+inline unsigned count_trailing_zeros( ::std::uint64_t val )
+{
+    const auto low { ::std::uint32_t( val ) };
+
+    return low ? count_trailing_zeros( unsigned( low ) ) : 32 + count_trailing_zeros( unsigned( val >> 32 ) );
+}
+
+struct block_masks
+{
+    ::std::uint64_t blanks;
+    ::std::uint64_t newlines;
+};
+
+// Marks the blanks and the line breaks among the 64 bytes at 'data' with a
+// bit each.
+inline block_masks classify_block( const char* data )
+{
+    const __m128i space   = _mm_set1_epi8( ' ' );
+    const __m128i tab     = _mm_set1_epi8( '\t' );
+    const __m128i newline = _mm_set1_epi8( '\n' );
+    const __m128i span    = _mm_set1_epi8( '\r' - '\t' );
+
+    block_masks masks {};
+
+    for ( int i = 0; i < 4; ++i )
+    {
+        const __m128i bytes    = _mm_loadu_si128( reinterpret_cast<const __m128i*>( data + 16 * i ) );
+        const __m128i controls = _mm_sub_epi8( bytes , tab );
+        const __m128i blanks   = _mm_or_si128(
+                                     _mm_cmpeq_epi8( bytes , space ) ,
+                                     _mm_cmpeq_epi8( _mm_min_epu8( controls , span ) , controls )
+                                 );
+
+        masks.blanks   |= ::std::uint64_t( unsigned( _mm_movemask_epi8( blanks ) ) ) << ( 16 * i );
+        masks.newlines |= ::std::uint64_t( unsigned( _mm_movemask_epi8( _mm_cmpeq_epi8( bytes , newline ) ) ) ) << ( 16 * i );
+    }
+
+    return masks;
+}
+
+// Finds the fields of the line starting at 'first' and returns where the
+// line ends. The text is classified 64 bytes at a time into bitmasks of
+// blanks and line breaks, and fields start and end at the bits where the
+// mask of the other characters changes, so there is no branch per byte.
+// Blocks are read straight from the text as long as they lie within it.
+template<typename Fields>
+inline const char* scan_line( const char* first , const char* last , Fields& fields )
+{
+    fields.clear();
+
+    const char*     start {};
+    ::std::uint64_t carry {};
+
+    for ( auto block { first }; block < last; block += 64 )
+    {
+        alignas( 16 ) char tail[ 64 ];
+        auto data { block };
+
+        if ( last - block < 64 )
+        {
+            ::std::memset( tail , '\n' , sizeof( tail ) );
+            ::std::memcpy( tail , block , ::std::size_t( last - block ) );
+
+            data = tail;
+        }
+
+        const auto masks { classify_block( data ) };
+        auto others { ~masks.blanks };
+
+        if ( masks.newlines )
+            others &= ( masks.newlines & ( ~masks.newlines + 1 ) ) - 1;
+
+        auto edges { others ^ ( ( others << 1 ) | carry ) };
+
+        carry = others >> 63;
+
+        for ( ; edges; edges &= edges - 1 )
+        {
+            const auto edge { block + count_trailing_zeros( edges ) };
+
+            if ( start )
+            {
+                fields.emplace_back( start , ::std::size_t( edge - start ) );
+                start = nullptr;
+            }
+            else
+            {
+                start = edge;
+            }
+        }
+
+        if ( masks.newlines )
+            return ::std::min( block + count_trailing_zeros( masks.newlines ) , last );
+    }
+
+    // A text ending without a line break right at a block boundary leaves
+    // its last field open.
+    if ( start )
+        fields.emplace_back( start , ::std::size_t( last - start ) );
+
+    return last;
+}
+
+#else
+
+template<typename Fields>
+inline const char* scan_line( const char* first , const char* last , Fields& fields )
+{
+    const auto end { static_cast<const char*>( ::std::memchr( first , '\n' , ::std::size_t( last - first ) ) ) };
+    const auto line_end { end ? end : last };
+
+    split_fields( { first , ::std::size_t( line_end - first ) } , fields );
+
+    return line_end;
+}
+
+#endif
+
+// Cuts 'text' into at most 'count' pieces of about the same size, each
+// ending with a line break except for the last one.
+inline ::std::vector<::std::string_view> split_chunks( ::std::string_view text , ::std::size_t count )
+{
+    ::std::vector<::std::string_view> chunks;
+
+    chunks.reserve( count );
+
+    const auto size { ::std::max<::std::size_t>( text.size() / count , 1 ) };
+
+    while ( !text.empty() )
+    {
+        auto end { chunks.size() + 1 < count ? text.find( '\n' , size - 1 ) : ::std::string_view::npos };
+
+        end = end == ::std::string_view::npos ? text.size() : end + 1;
+
+        chunks.push_back( text.substr( 0 , end ) );
+        text.remove_prefix( end );
+    }
+
+    return chunks;
+}
+
+inline unsigned thread_count( unsigned threads ) noexcept
+{
+    return threads ? threads : ::std::max( ::std::thread::hardware_concurrency() , 1u );
+}
+
+// Calls 'task' with each index below 'count' on up to 'threads' threads,
+// the calling one included. Every thread takes the next index as soon as it
+// is done with the previous one. The first exception thrown stops the
+// remaining tasks and is rethrown once all threads have finished.
+template<typename Task>
+inline void run_parallel( ::std::size_t count , unsigned threads , const Task& task )
+{
+    ::std::atomic<::std::size_t>    next {};
+    ::std::exception_ptr            error;
+    ::std::mutex                    error_mutex;
+
+    auto work = [ & ]
+    {
+        for ( auto idx { next++ }; idx < count; idx = next++ )
+        {
+            try
+            {
+                task( idx );
+            }
+            catch ( ... )
+            {
+                ::std::lock_guard<::std::mutex> lock { error_mutex };
+
+                if ( !error )
+                    error = ::std::current_exception();
+
+                next = count;
+            }
+        }
+    };
+
+    ::std::vector<::std::thread> workers;
+
+    try
+    {
+        for ( auto i { 1u }; i < threads && i < count; ++i )
+            workers.emplace_back( work );
+    }
+    catch ( ... )
+    {
+        next = count;
+
+        for ( auto& worker : workers )
+            worker.join();
+
+        throw;
+    }
+
+    work();
+
+    for ( auto& worker : workers )
+        worker.join();
+
+    if ( error )
+        ::std::rethrow_exception( error );
+}
+
+// Removes the first line of 'text' and returns it without its line break.
+inline ::std::string_view next_line( ::std::string_view& text ) noexcept
+{
+    const auto end { text.find( '\n' ) };
+    auto line { text.substr( 0 , end ) };
+
+    text.remove_prefix( end == ::std::string_view::npos ? text.size() : end + 1 );
+
+    if ( !line.empty() && line.back() == '\r' )
+        line.remove_suffix( 1 );
+
+    return line;
+}
+
+// How the fields of a column are laid out, including the base, fill and
+// adjustment the column inherits from the columns printed before it.
+struct field_format
+{
+    int             base;
+    ::std::size_t   offset;
+    ::std::size_t   width;
+    char            fill;
+    bool            left;
+};
+
+// Strips the padding of a field. Spaces are stripped from both sides, so a
+// field still comes out right when the stream was left with another
+// adjustment than the reader expects. Other fills are only stripped from
+// the padded side and a field made up of them keeps its last character,
+// since it is the value itself, e.g. a zero printed with fill '0'.
+inline ::std::string_view trim_fill( ::std::string_view field , const field_format& format ) noexcept
+{
+    if ( format.fill == ' ' )
+    {
+        while ( !field.empty() && field.front() == ' ' )
+            field.remove_prefix( 1 );
+
+        while ( !field.empty() && field.back() == ' ' )
+            field.remove_suffix( 1 );
+
+        return field;
+    }
+
+    if ( format.left )
+    {
+        while ( field.size() > 1 && field.back() == format.fill )
+            field.remove_suffix( 1 );
+    }
+    else
+    {
+        while ( field.size() > 1 && field.front() == format.fill )
+            field.remove_prefix( 1 );
+    }
+
+    return field;
+}
+
+// Cuts a row whose values all fit into their columns at the columns' offsets.
+template<typename Fields>
+inline void slice_fields( ::std::string_view line , const field_format* formats , ::std::size_t count , Fields& fields )
+{
+    fields.clear();
+
+    for ( ::std::size_t idx {}; idx < count; ++idx )
+        fields.push_back( trim_fill( line.substr( formats[ idx ].offset , formats[ idx ].width ) , formats[ idx ] ) );
+}
+
+constexpr int base_of( ::std::ios_base::fmtflags flags ) noexcept
+{
+    switch ( flags & ::std::ios_base::basefield )
+    {
+    case ::std::ios_base::hex:
+        return 16;
+    case ::std::ios_base::oct:
+        return 8;
+    default:
+        return 10;
+    }
+}
+
+template<typename T>
+inline bool parse_field( ::std::string_view field , int base , T& value )
+{
+    static_assert(
+        !::std::is_same_v<T , bool> &&
+        !::std::is_same_v<T , char> &&
+        !::std::is_same_v<T , signed char> &&
+        !::std::is_same_v<T , unsigned char> ,
+        "Booleans and characters are read as 'std::string_view' fields."
+    );
+
+    const auto first { field.data() };
+    const auto last { first + field.size() };
+
+    if constexpr ( ::std::is_integral_v<T> )
+    {
+        if constexpr ( ::std::is_signed_v<T> )
+        {
+            // Streams print negative values in hex and octal as the bits of
+            // their unsigned counterpart.
+            if ( base != 10 )
+            {
+                ::std::make_unsigned_t<T> bits;
+
+                if ( !parse_field( field , base , bits ) )
+                    return false;
+
+                value = T( bits );
+
+                return true;
+            }
+        }
+
+        const auto result { ::std::from_chars( first , last , value , base ) };
+
+        return result.ec == ::std::errc {} && result.ptr == last;
+    }
+    else
+    {
+        static_assert( ::std::is_floating_point_v<T> , "Fields are read as arithmetic values, 'std::string' or 'std::string_view'." );
+
+#if defined( __cpp_lib_to_chars ) && __cpp_lib_to_chars >= 201611L
+        const auto result { ::std::from_chars( first , last , value ) };
+
+        return result.ec == ::std::errc {} && result.ptr == last;
+#else
+        char text[ 128 ];
+
+        if ( field.empty() || field.size() >= sizeof( text ) )
+            return false;
+
+        ::std::memcpy( text , first , field.size() );
+        text[ field.size() ] = '\0';
+
+        char* end {};
+
+        if constexpr ( ::std::is_same_v<T , float> )
+            value = ::std::strtof( text , &end );
+        else if constexpr ( ::std::is_same_v<T , double> )
+            value = ::std::strtod( text , &end );
+        else
+            value = ::std::strtold( text , &end );
+
+        return end == text + field.size();
+#endif
+    }
+}
+
+}
+
+// The values of a text column, stored back to back in one buffer with the
+// offsets where each of them starts, so a column costs two allocations no
+// matter how many values it holds.
+class string_column
+{
+public:
+
+    ::std::size_t size() const noexcept
+    {
+        return m_offsets.size() - 1;
+    }
+
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    ::std::string_view operator[]( ::std::size_t idx ) const noexcept
+    {
+        return { m_chars.data() + m_offsets[ idx ] , m_offsets[ idx + 1 ] - m_offsets[ idx ] };
+    }
+
+    const ::std::string& chars() const noexcept
+    {
+        return m_chars;
+    }
+
+    const ::std::vector<::std::size_t>& offsets() const noexcept
+    {
+        return m_offsets;
+    }
+
+    void reserve( ::std::size_t count )
+    {
+        m_offsets.reserve( count + 1 );
+    }
+
+    void push_back( ::std::string_view value )
+    {
+        m_chars.append( value );
+        m_offsets.push_back( m_chars.size() );
+    }
+
+    inline void append( const string_column& other );
+
+private:
+
+    ::std::string                   m_chars;
+    ::std::vector<::std::size_t>    m_offsets { 0 };
+};
+
+namespace detail
+{
+
+template<typename T>
+struct column_storage
+{
+    using type = ::std::vector<T>;
+};
+
+template<>
+struct column_storage<::std::string>
+{
+    using type = string_column;
+};
+
+template<typename T>
+inline void append_values( ::std::vector<T>& values , ::std::vector<T>&& other )
+{
+    values.insert( values.end() , ::std::make_move_iterator( other.begin() ) , ::std::make_move_iterator( other.end() ) );
+}
+
+inline void append_values( string_column& values , string_column&& other )
+{
+    values.append( other );
+}
+
+template<typename T>
+struct sum_type
+{
+    using type = ::std::conditional_t<::std::is_signed_v<T> , long long , unsigned long long>;
+};
+
+template<>
+struct sum_type<float>
+{
+    using type = double;
+};
+
+template<>
+struct sum_type<double>
+{
+    using type = double;
+};
+
+template<>
+struct sum_type<long double>
+{
+    using type = long double;
+};
+
+}
+
+// How the values of a column read as 'T' are stored by
+// 'reader::read_columns': numbers and views in a 'std::vector' and copied
+// text in a 'string_column'.
+template<typename T>
+using column_values = typename detail::column_storage<T>::type;
+
+template<typename T>
+struct column_summary
+{
+    T                                   min;
+    T                                   max;
+    typename detail::sum_type<T>::type  sum;
+    ::std::size_t                       count;
+};
+
+// Finds the minimum, the maximum and the sum of 'values' in one pass over
+// them. Eight lanes of partial results are kept apart and combined at the
+// end, so there is neither a branch nor a chain of dependent additions per
+// value, and compilers can turn the loop into SIMD instructions. Integers
+// are summed as 'long long' and floats as 'double'. Floats are summed per
+// lane before the lanes are added up, so the sum can differ in its last
+// bits from the one of a sequential loop. An empty column has the largest
+// value of 'T' as its minimum and the lowest one as its maximum.
+template<typename T>
+inline column_summary<T> summarize( const ::std::vector<T>& values ) noexcept
+{
+    static_assert( ::std::is_arithmetic_v<T> , "Only numeric columns can be summarized." );
+
+    using sum_type = typename detail::sum_type<T>::type;
+
+    constexpr ::std::size_t lanes { 8 };
+
+    T        mins[ lanes ];
+    T        maxs[ lanes ];
+    sum_type sums[ lanes ] {};
+
+    for ( ::std::size_t lane {}; lane < lanes; ++lane )
+    {
+        mins[ lane ] = ::std::numeric_limits<T>::max();
+        maxs[ lane ] = ::std::numeric_limits<T>::lowest();
+    }
+
+    const auto data { values.data() };
+    const auto count { values.size() };
+
+    ::std::size_t idx {};
+
+    for ( ; idx + lanes <= count; idx += lanes )
+    {
+        for ( ::std::size_t lane {}; lane < lanes; ++lane )
+        {
+            const T value { data[ idx + lane ] };
+
+            mins[ lane ]  = value < mins[ lane ] ? value : mins[ lane ];
+            maxs[ lane ]  = maxs[ lane ] < value ? value : maxs[ lane ];
+            sums[ lane ] += value;
+        }
+    }
+
+    for ( ::std::size_t lane {}; idx < count; ++idx , ++lane )
+    {
+        mins[ lane ]  = data[ idx ] < mins[ lane ] ? data[ idx ] : mins[ lane ];
+        maxs[ lane ]  = maxs[ lane ] < data[ idx ] ? data[ idx ] : maxs[ lane ];
+        sums[ lane ] += data[ idx ];
+    }
+
+    column_summary<T> summary { mins[ 0 ] , maxs[ 0 ] , sums[ 0 ] , count };
+
+    for ( ::std::size_t lane { 1 }; lane < lanes; ++lane )
+    {
+        summary.min  = mins[ lane ] < summary.min ? mins[ lane ] : summary.min;
+        summary.max  = summary.max < maxs[ lane ] ? maxs[ lane ] : summary.max;
+        summary.sum += sums[ lane ];
+    }
+
+    return summary;
+}
+
+// Reads back the rows of a table printed with the same columns. Fields are
+// views into the text, so iterating over a mapped file copies nothing and the
+// only allocation is the field list of the iterator. Numbers are parsed with
+// 'std::from_chars' in the base their column was printed with, including the
+// base left over on the stream by preceding columns.
+//
+// When every column has a fixed width, a row whose values all fit is exactly
+// as long as the widths add up to and its fields are cut at their offsets
+// without scanning, so values may contain spaces. Other rows, e.g. the ones
+// with an overflowing value, are split on whitespace, which only works out
+// when their fields are separated by blank padding. Splitting scans 64 bytes
+// at a time with SSE2 where it is available. Either way the fill characters
+// padding a field are trimmed.
+class reader
+{
+public:
+
+    class row;
+    class iterator;
+
+    inline reader( const ::std::vector<column>& columns , ::std::string_view text );
+    inline reader( const ::std::vector<column>& columns , mapped_file file );
+
+    inline reader& skip_lines( ::std::size_t count );
+    inline reader& skip_headers();
+
+    inline iterator begin() const;
+    inline iterator end() const noexcept;
+
+    // Calls 'f' with every row from 'threads' threads at once, or from as
+    // many as the hardware runs concurrently if it is 0. The text is split
+    // at line breaks into pieces which the threads parse independently, so
+    // the rows come in no particular order and 'row::line()' tells them
+    // apart.
+    template<typename Function>
+    inline const reader& for_each_row( const Function& f , unsigned threads = 0 ) const;
+
+    // Parses every row into a tuple of 'Ts' on 'threads' threads like
+    // 'for_each_row' and returns them in the order of the text.
+    template<typename... Ts>
+    inline ::std::vector<::std::tuple<Ts...>> read_rows( unsigned threads = 0 ) const;
+
+    // Parses every row on 'threads' threads like 'read_rows' but stores each
+    // column in a contiguous 'column_values<T>' of its own, so scanning a
+    // column touches nothing but its values.
+    template<typename... Ts>
+    inline ::std::tuple<column_values<Ts>...> read_columns( unsigned threads = 0 ) const;
+
+    ::std::size_t columns() const noexcept
+    {
+        return size( m_columns );
+    }
+
+    ::std::string_view text() const noexcept
+    {
+        return m_text;
+    }
+
+private:
+
+    // A piece of the text which ends at a line break, along with the number
+    // of the line before it, the number of lines it holds and whether it
+    // holds the first row.
+    struct chunk
+    {
+        ::std::string_view  text;
+        ::std::size_t       line;
+        ::std::size_t       lines;
+        bool                first;
+    };
+
+    static constexpr ::std::size_t min_chunk_size { 1 << 16 };
+
+    inline void compile_columns( bool after_headers = false );
+    inline ::std::vector<chunk> split_chunks( unsigned threads ) const;
+
+    template<typename Function>
+    inline void parse_chunks( const ::std::vector<chunk>& , unsigned threads , const Function& f ) const;
+
+    template<typename T>
+    static inline void push_field( ::std::vector<T>& , const row& , ::std::size_t col );
+
+    static inline void push_field( string_column& , const row& , ::std::size_t col );
+
+    template<typename Columns , ::std::size_t... Idx>
+    static inline void push_fields( Columns& , const row& , ::std::index_sequence<Idx...> );
+
+    template<typename Columns , ::std::size_t... Idx>
+    static inline void reserve_columns( Columns& , ::std::size_t count , ::std::index_sequence<Idx...> );
+
+    template<typename Columns , ::std::size_t... Idx>
+    static inline void append_columns( Columns& , Columns&& , ::std::index_sequence<Idx...> );
+
+    ::std::vector<column>               m_columns;
+    ::std::vector<detail::field_format> m_formats;
+    mapped_file                         m_file;
+    ::std::string_view                  m_text;
+    ::std::size_t                       m_line {};
+    ::std::size_t                       m_row_width {};
+    bool                                m_fixed {};
+};
+
+class reader::row
+{
+public:
+
+    ::std::size_t size() const noexcept
+    {
+        return m_fields.size();
+    }
+
+    ::std::string_view operator[]( ::std::size_t col ) const noexcept
+    {
+        return m_fields[ col ];
+    }
+
+    ::std::vector<::std::string_view>::const_iterator begin() const noexcept
+    {
+        return m_fields.begin();
+    }
+
+    ::std::vector<::std::string_view>::const_iterator end() const noexcept
+    {
+        return m_fields.end();
+    }
+
+    template<typename T>
+    inline T get( ::std::size_t col ) const;
+
+    template<typename... Ts>
+    inline ::std::tuple<Ts...> as() const;
+
+    // The number of the line, counting from 1 at the beginning of the text.
+    ::std::size_t line() const noexcept
+    {
+        return m_line;
+    }
+
+    ::std::string_view text() const noexcept
+    {
+        return m_text;
+    }
+
+private:
+
+    friend class reader::iterator;
+
+    template<typename... Ts , ::std::size_t... Idx>
+    inline ::std::tuple<Ts...> as( ::std::index_sequence<Idx...> ) const;
+
+    ::std::vector<::std::string_view>   m_fields;
+    ::std::string_view                  m_text;
+    const detail::field_format*         m_formats {};
+    ::std::size_t                       m_line {};
+};
+
+class reader::iterator
+{
+public:
+
+    using iterator_category = ::std::input_iterator_tag;
+    using value_type        = row;
+    using difference_type   = ::std::ptrdiff_t;
+    using pointer           = const row*;
+    using reference         = const row&;
+
+    iterator() = default;
+
+    const row& operator*() const noexcept
+    {
+        return m_row;
+    }
+
+    const row* operator->() const noexcept
+    {
+        return &m_row;
+    }
+
+    inline iterator& operator++();
+
+    bool operator==( const iterator& other ) const noexcept
+    {
+        return m_done == other.m_done && ( m_done || m_row.m_text.data() == other.m_row.m_text.data() );
+    }
+
+    bool operator!=( const iterator& other ) const noexcept
+    {
+        return !( *this == other );
+    }
+
+private:
+
+    friend class reader;
+
+    inline iterator( const reader& , ::std::string_view text , ::std::size_t line , bool first = true );
+
+    inline void throw_if_fields_size_mismatch() const;
+
+    const reader*       m_reader {};
+    ::std::string_view  m_rest;
+    row                 m_row;
+    ::std::size_t       m_rows {};
+    bool                m_done { true };
+};
+
+}
+
+tableprinter::mapped_file::mapped_file( const char* path )
+{
+#ifdef TABLEPRINTER_POSIX
+    const int fd { ::open( path , O_RDONLY | O_CLOEXEC ) };
+    struct ::stat info {};
+
+    if ( fd < 0 || ::fstat( fd , &info ) != 0 )
+    {
+        if ( fd >= 0 )
+            ::close( fd );
+
+        throw file_could_not_be_read { "'" + ::std::string { path } + "' could not be read." };
+    }
+
+    if ( info.st_size > 0 )
+    {
+        void* data { ::mmap( nullptr , ::std::size_t( info.st_size ) , PROT_READ , MAP_PRIVATE , fd , 0 ) };
+
+        ::close( fd );
+
+        if ( data == MAP_FAILED )
+            throw file_could_not_be_read { "'" + ::std::string { path } + "' could not be mapped." };
+
+        ::madvise( data , ::std::size_t( info.st_size ) , MADV_SEQUENTIAL );
+
+        m_data = static_cast<const char*>( data );
+        m_size = ::std::size_t( info.st_size );
+    }
+    else
+    {
+        ::close( fd );
+    }
+#else
+    ::std::ifstream file { path , ::std::ios_base::binary | ::std::ios_base::ate };
+
+    if ( !file )
+        throw file_could_not_be_read { "'" + ::std::string { path } + "' could not be read." };
+
+    m_size = ::std::size_t( file.tellg() );
+    m_contents = ::std::make_unique<char[]>( m_size );
+    m_data = m_contents.get();
+
+    file.seekg( 0 );
+
+    if ( !file.read( m_contents.get() , ::std::streamsize( m_size ) ) )
+        throw file_could_not_be_read { "'" + ::std::string { path } + "' could not be read." };
+#endif
+}
+
+tableprinter::mapped_file::mapped_file( mapped_file&& other ) noexcept
+    :   m_data { ::std::exchange( other.m_data , nullptr ) }
+    ,   m_size { ::std::exchange( other.m_size , 0 ) }
+#ifndef TABLEPRINTER_POSIX
+    ,   m_contents { ::std::move( other.m_contents ) }
+#endif
+{   }
+
+tableprinter::mapped_file& tableprinter::mapped_file::operator=( mapped_file&& other ) noexcept
+{
+    if ( this != &other )
+    {
+        release();
+
+        m_data = ::std::exchange( other.m_data , nullptr );
+        m_size = ::std::exchange( other.m_size , 0 );
+#ifndef TABLEPRINTER_POSIX
+        m_contents = ::std::move( other.m_contents );
+#endif
+    }
+
+    return *this;
+}
+
+tableprinter::mapped_file::~mapped_file()
+{
+    release();
+}
+
+void tableprinter::mapped_file::release() noexcept
+{
+#ifdef TABLEPRINTER_POSIX
+    if ( m_data )
+        ::munmap( const_cast<char*>( m_data ) , m_size );
+#else
+    m_contents.reset();
+#endif
+
+    m_data = nullptr;
+    m_size = 0;
+}
+
+void tableprinter::string_column::append( const string_column& other )
+{
+    const auto base { m_chars.size() };
+
+    m_chars.append( other.m_chars );
+    m_offsets.reserve( m_offsets.size() + other.size() );
+
+    for ( auto it { other.m_offsets.begin() + 1 }; it != other.m_offsets.end(); ++it )
+        m_offsets.push_back( base + *it );
+}
+
+tableprinter::reader::reader( const ::std::vector<column>& columns , ::std::string_view text )
+    :   m_columns { columns }
+    ,   m_text { text }
+{
+    compile_columns();
+}
+
+tableprinter::reader::reader( const ::std::vector<column>& columns , mapped_file file )
+    :   m_columns { columns }
+    ,   m_file { ::std::move( file ) }
+    ,   m_text { m_file.view() }
+{
+    compile_columns();
+}
+
+void tableprinter::reader::compile_columns( bool after_headers )
+{
+    // A column without a base, fill or adjustment option is printed with the
+    // ones the previous columns left on the stream. The first row starts from
+    // the stream's defaults, or from the adjustment the header line left, and
+    // every other row from the state left by the row before.
+    auto flags { ::std::ios_base::dec };
+    char fill { ' ' };
+
+    ::std::vector<detail::column_plan> plans;
+
+    plans.reserve( size( m_columns ) );
+
+    for ( const auto& col : m_columns )
+        plans.push_back( detail::compile( col.options ) );
+
+    if ( after_headers )
+    {
+        for ( const auto& plan : plans )
+        {
+            const auto mask { plan.mask & ::std::ios_base::adjustfield };
+
+            flags = ( flags & ~mask ) | ( plan.flags & mask );
+        }
+    }
+
+    m_formats.resize( 2 * size( m_columns ) );
+    m_fixed = !m_columns.empty();
+
+    for ( ::std::size_t pass {}; pass < 2; ++pass )
+    {
+        m_row_width = 0;
+
+        for ( ::std::size_t idx {}; idx < size( m_columns ); ++idx )
+        {
+            const auto& plan { plans[ idx ] };
+
+            flags = ( flags & ~plan.mask ) | ( plan.flags & plan.mask );
+
+            if ( plan.has_fill )
+                fill = plan.fill;
+
+            auto& format { m_formats[ pass * size( m_columns ) + idx ] };
+
+            format.base   = detail::base_of( flags );
+            format.offset = m_row_width;
+            format.width  = plan.has_width && plan.width > 0 && !plan.auto_width ? ::std::size_t( plan.width ) : 0;
+            format.fill   = fill;
+            format.left   = ( flags & ::std::ios_base::adjustfield ) == ::std::ios_base::left;
+
+            m_fixed      = m_fixed && format.width;
+            m_row_width += format.width;
+        }
+    }
+}
+
+tableprinter::reader& tableprinter::reader::skip_lines( ::std::size_t count )
+{
+    for ( ; count && !m_text.empty(); --count , ++m_line )
+        detail::next_line( m_text );
+
+    return *this;
+}
+
+tableprinter::reader& tableprinter::reader::skip_headers()
+{
+    ::std::ostringstream header;
+
+    printer { m_columns , header }.print_headers();
+
+    auto expected { header.str() };
+
+    expected.pop_back();
+
+    for ( auto text { m_text }; !text.empty(); )
+    {
+        const auto line { detail::next_line( text ) };
+
+        ++m_line;
+
+        if ( line == expected )
+        {
+            m_text = text;
+
+            compile_columns( true );
+
+            return *this;
+        }
+    }
+
+    throw header_not_found { "The header line '" + expected + "' could not be found." };
+}
+
+tableprinter::reader::iterator tableprinter::reader::begin() const
+{
+    return { *this , m_text , m_line };
+}
+
+tableprinter::reader::iterator tableprinter::reader::end() const noexcept
+{
+    return {};
+}
+
+template<typename Function>
+const tableprinter::reader& tableprinter::reader::for_each_row( const Function& f , unsigned threads ) const
+{
+    threads = detail::thread_count( threads );
+
+    parse_chunks(
+        split_chunks( threads ) ,
+        threads ,
+        [ &f ]( ::std::size_t , const row& r )
+        {
+            f( r );
+        }
+    );
+
+    return *this;
+}
+
+template<typename... Ts>
+::std::vector<::std::tuple<Ts...>> tableprinter::reader::read_rows( unsigned threads ) const
+{
+    threads = detail::thread_count( threads );
+
+    const auto chunks { split_chunks( threads ) };
+
+    ::std::vector<::std::vector<::std::tuple<Ts...>>> parts( size( chunks ) );
+
+    for ( ::std::size_t idx {}; idx < size( chunks ); ++idx )
+        parts[ idx ].reserve( chunks[ idx ].lines + 1 );
+
+    parse_chunks(
+        chunks ,
+        threads ,
+        [ &parts ]( ::std::size_t idx , const row& r )
+        {
+            parts[ idx ].push_back( r.as<Ts...>() );
+        }
+    );
+
+    if ( size( parts ) == 1 )
+        return ::std::move( parts.front() );
+
+    ::std::size_t count {};
+
+    for ( const auto& part : parts )
+        count += size( part );
+
+    ::std::vector<::std::tuple<Ts...>> rows;
+
+    rows.reserve( count );
+
+    for ( auto& part : parts )
+        rows.insert( rows.end() , ::std::make_move_iterator( part.begin() ) , ::std::make_move_iterator( part.end() ) );
+
+    return rows;
+}
+
+template<typename... Ts>
+::std::tuple<tableprinter::column_values<Ts>...> tableprinter::reader::read_columns( unsigned threads ) const
+{
+    using columns_type = ::std::tuple<column_values<Ts>...>;
+
+    if ( sizeof...( Ts ) != columns() )
+    {
+        throw arguments_size_doesnt_match_with_columns {
+            "There are " +
+            ::std::to_string( columns() ) +
+            " columns but given " +
+            ::std::to_string( sizeof...( Ts ) ) +
+            " arguments."
+        };
+    }
+
+    threads = detail::thread_count( threads );
+
+    const auto chunks { split_chunks( threads ) };
+
+    ::std::vector<columns_type> parts( size( chunks ) );
+
+    for ( ::std::size_t idx {}; idx < size( chunks ); ++idx )
+        reserve_columns( parts[ idx ] , chunks[ idx ].lines + 1 , ::std::index_sequence_for<Ts...> {} );
+
+    parse_chunks(
+        chunks ,
+        threads ,
+        [ &parts ]( ::std::size_t idx , const row& r )
+        {
+            push_fields( parts[ idx ] , r , ::std::index_sequence_for<Ts...> {} );
+        }
+    );
+
+    if ( parts.empty() )
+        return {};
+
+    auto values { ::std::move( parts.front() ) };
+
+    if ( size( parts ) > 1 )
+    {
+        ::std::size_t lines { size( chunks ) };
+
+        for ( const auto& piece : chunks )
+            lines += piece.lines;
+
+        reserve_columns( values , lines , ::std::index_sequence_for<Ts...> {} );
+
+        for ( auto it { parts.begin() + 1 }; it != parts.end(); ++it )
+            append_columns( values , ::std::move( *it ) , ::std::index_sequence_for<Ts...> {} );
+    }
+
+    return values;
+}
+
+template<typename T>
+void tableprinter::reader::push_field( ::std::vector<T>& values , const row& r , ::std::size_t col )
+{
+    values.push_back( r.get<T>( col ) );
+}
+
+void tableprinter::reader::push_field( string_column& values , const row& r , ::std::size_t col )
+{
+    values.push_back( r[ col ] );
+}
+
+template<typename Columns , ::std::size_t... Idx>
+void tableprinter::reader::push_fields( Columns& columns , const row& r , ::std::index_sequence<Idx...> )
+{
+    ( push_field( ::std::get<Idx>( columns ) , r , Idx ) , ... );
+}
+
+template<typename Columns , ::std::size_t... Idx>
+void tableprinter::reader::reserve_columns( Columns& columns , ::std::size_t count , ::std::index_sequence<Idx...> )
+{
+    ( ::std::get<Idx>( columns ).reserve( count ) , ... );
+}
+
+template<typename Columns , ::std::size_t... Idx>
+void tableprinter::reader::append_columns( Columns& columns , Columns&& other , ::std::index_sequence<Idx...> )
+{
+    ( detail::append_values( ::std::get<Idx>( columns ) , ::std::move( ::std::get<Idx>( other ) ) ) , ... );
+}
+
+::std::vector<tableprinter::reader::chunk> tableprinter::reader::split_chunks( unsigned threads ) const
+{
+    // A few pieces per thread keep the threads busy when some pieces parse
+    // slower than others.
+    const auto pieces { ::std::min<::std::size_t>( 4 * ::std::size_t( threads ) , m_text.size() / min_chunk_size + 1 ) };
+    const auto texts { detail::split_chunks( m_text , pieces ) };
+
+    ::std::vector<chunk> chunks( size( texts ) );
+
+    detail::run_parallel(
+        size( texts ) ,
+        threads ,
+        [ &texts , &chunks ]( ::std::size_t idx )
+        {
+            chunks[ idx ].text  = texts[ idx ];
+            chunks[ idx ].lines = ::std::size_t( ::std::count( texts[ idx ].begin() , texts[ idx ].end() , '\n' ) );
+        }
+    );
+
+    auto line { m_line };
+
+    for ( auto& piece : chunks )
+    {
+        piece.line  = line;
+        piece.first = &piece == &chunks.front();
+        line       += piece.lines;
+    }
+
+    return chunks;
+}
+
+template<typename Function>
+void tableprinter::reader::parse_chunks( const ::std::vector<chunk>& chunks , unsigned threads , const Function& f ) const
+{
+    detail::run_parallel(
+        size( chunks ) ,
+        threads ,
+        [ this , &chunks , &f ]( ::std::size_t idx )
+        {
+            const auto& piece { chunks[ idx ] };
+
+            for ( iterator it { *this , piece.text , piece.line , piece.first }; it != end(); ++it )
+                f( idx , *it );
+        }
+    );
+}
+
+template<typename T>
+T tableprinter::reader::row::get( ::std::size_t col ) const
+{
+    const auto field { m_fields[ col ] };
+
+    if constexpr ( ::std::is_same_v<T , ::std::string_view> )
+    {
+        return field;
+    }
+    else if constexpr ( ::std::is_same_v<T , ::std::string> )
+    {
+        return T { field };
+    }
+    else
+    {
+        T value {};
+
+        if ( !detail::parse_field( field , m_formats[ col ].base , value ) )
+        {
+            throw invalid_field {
+                "'" +
+                ::std::string { field } +
+                "' at line " +
+                ::std::to_string( m_line ) +
+                " is not a valid value of column " +
+                ::std::to_string( col ) +
+                "."
+            };
+        }
+
+        return value;
+    }
+}
+
+template<typename... Ts>
+::std::tuple<Ts...> tableprinter::reader::row::as() const
+{
+    if ( sizeof...( Ts ) != size() )
+    {
+        throw arguments_size_doesnt_match_with_columns {
+            "There are " +
+            ::std::to_string( size() ) +
+            " columns but given " +
+            ::std::to_string( sizeof...( Ts ) ) +
+            " arguments."
+        };
+    }
+
+    return as<Ts...>( ::std::index_sequence_for<Ts...> {} );
+}
+
+template<typename... Ts , ::std::size_t... Idx>
+::std::tuple<Ts...> tableprinter::reader::row::as( ::std::index_sequence<Idx...> ) const
+{
+    return ::std::tuple<Ts...> { get<Ts>( Idx )... };
+}
+
+tableprinter::reader::iterator::iterator( const reader& r , ::std::string_view text , ::std::size_t line , bool first )
+    :   m_reader { &r }
+    ,   m_rest { text }
+    ,   m_rows { first ? 0u : 1u }
+    ,   m_done { false }
+{
+    m_row.m_line = line;
+    m_row.m_fields.reserve( r.columns() );
+
+    ++*this;
+}
+
+tableprinter::reader::iterator& tableprinter::reader::iterator::operator++()
+{
+    const auto columns { m_reader->columns() };
+
+    while ( !m_rest.empty() )
+    {
+        const auto formats { m_reader->m_formats.data() + ( m_rows ? columns : 0 ) };
+
+        ++m_row.m_line;
+
+        if ( m_reader->m_fixed )
+        {
+            m_row.m_text = detail::next_line( m_rest );
+
+            if ( m_row.m_text.size() == m_reader->m_row_width )
+            {
+                detail::slice_fields( m_row.m_text , formats , columns , m_row.m_fields );
+
+                m_row.m_formats = formats;
+                ++m_rows;
+
+                return *this;
+            }
+
+            detail::scan_line( m_row.m_text.data() , m_row.m_text.data() + m_row.m_text.size() , m_row.m_fields );
+        }
+        else
+        {
+            const auto first { m_rest.data() };
+            const auto end { detail::scan_line( first , first + m_rest.size() , m_row.m_fields ) };
+
+            m_row.m_text = { first , ::std::size_t( end - first ) };
+            m_rest.remove_prefix( ::std::min( m_row.m_text.size() + 1 , m_rest.size() ) );
+
+            if ( !m_row.m_text.empty() && m_row.m_text.back() == '\r' )
+                m_row.m_text.remove_suffix( 1 );
+        }
+
+        if ( m_row.m_fields.empty() )
+            continue;
+
+        throw_if_fields_size_mismatch();
+
+        for ( ::std::size_t idx {}; idx < columns; ++idx )
+            m_row.m_fields[ idx ] = detail::trim_fill( m_row.m_fields[ idx ] , formats[ idx ] );
+
+        m_row.m_formats = formats;
+        ++m_rows;
+
+        return *this;
+    }
+
+    m_done = true;
+
+    return *this;
+}
+
+void tableprinter::reader::iterator::throw_if_fields_size_mismatch() const
+{
+    const auto columns { m_reader->columns() };
+
+    if ( m_row.m_fields.size() != columns )
+    {
+        throw fields_size_doesnt_match_with_columns {
+            "Line " +
+            ::std::to_string( m_row.m_line ) +
+            " has " +
+            ::std::to_string( m_row.m_fields.size() ) +
+            " fields but there are " +
+            ::std::to_string( columns ) +
+            " columns."
+        };
+    }
+}
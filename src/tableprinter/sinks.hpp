@@ -0,0 +1,827 @@
+#pragma once
+
+#include <tableprinter/tableprinter.hpp>
+
+#if defined( TABLEPRINTER_POSIX ) && defined( __linux__ ) && !defined( TABLEPRINTER_NO_IO_URING )
+#if __has_include( <linux/io_uring.h> )
+#define TABLEPRINTER_IO_URING
+#endif
+#endif
+
+#ifdef TABLEPRINTER_POSIX
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#ifdef TABLEPRINTER_IO_URING
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <vector>
+#endif
+
+namespace tableprinter
+{
+
+namespace detail
+{
+
+// Accumulates output in a fixed size buffer and hands it to the file
+// descriptor with 'write'. A chunk which does not fit into the buffer is
+// written together with the buffered bytes by a single 'writev'.
+class fd_buffer : public ::std::streambuf
+{
+public:
+
+    inline fd_buffer( int fd , ::std::size_t capacity , bool owned );
+    inline ~fd_buffer() override;
+
+    fd_buffer( const fd_buffer& ) = delete;
+    fd_buffer& operator=( const fd_buffer& ) = delete;
+
+    int fd() const noexcept
+    {
+        return m_fd;
+    }
+
+protected:
+
+    inline int_type overflow( int_type ch ) override;
+    inline ::std::streamsize xsputn( const char* s , ::std::streamsize n ) override;
+    inline int sync() override;
+
+private:
+
+    inline bool write_all( ::iovec* iov , int count );
+
+    int m_fd;
+    bool m_owned;
+    ::std::size_t m_capacity;
+    ::std::unique_ptr<char[]> m_data;
+};
+
+// Uses a shared mapping of the file as its put area. When the mapping is
+// full, the file is extended by a chunk and the next window is mapped
+// starting at the page which holds the current position. The mapping is
+// kept across syncs, since what is written to it is already in the file,
+// and the file is truncated to the bytes written on destruction only.
+class mmap_buffer : public ::std::streambuf
+{
+public:
+
+    inline mmap_buffer( int fd , ::std::size_t chunk , bool owned );
+    inline ~mmap_buffer() override;
+
+    mmap_buffer( const mmap_buffer& ) = delete;
+    mmap_buffer& operator=( const mmap_buffer& ) = delete;
+
+    int fd() const noexcept
+    {
+        return m_fd;
+    }
+
+protected:
+
+    inline int_type overflow( int_type ch ) override;
+    inline ::std::streamsize xsputn( const char* s , ::std::streamsize n ) override;
+    inline int sync() override;
+
+private:
+
+    inline bool grow( ::std::size_t n );
+    inline void unmap();
+
+    int m_fd;
+    bool m_owned;
+    ::std::size_t m_chunk;
+    ::std::size_t m_page;
+    ::std::size_t m_size {};
+    ::std::size_t m_offset {};
+    ::std::size_t m_length {};
+    char* m_map {};
+};
+
+#ifdef TABLEPRINTER_IO_URING
+
+// Hands full buffers to the kernel through an io_uring instance without
+// waiting for them to be written. The buffers are registered with the ring
+// once and used round robin as the put area, so writing only blocks when
+// every buffer is still in flight. Syncing submits the current buffer and
+// waits for the outstanding completions. Short writes are resubmitted.
+class uring_buffer : public ::std::streambuf
+{
+public:
+
+    inline uring_buffer( int fd , ::std::size_t buffer_size , unsigned buffer_count );
+    inline ~uring_buffer() override;
+
+    uring_buffer( const uring_buffer& ) = delete;
+    uring_buffer& operator=( const uring_buffer& ) = delete;
+
+    bool valid() const noexcept
+    {
+        return m_ring >= 0;
+    }
+
+protected:
+
+    inline int_type overflow( int_type ch ) override;
+    inline ::std::streamsize xsputn( const char* s , ::std::streamsize n ) override;
+    inline int sync() override;
+
+private:
+
+    struct block
+    {
+        ::std::unique_ptr<char[]> data;
+        ::std::size_t offset {};
+        ::std::size_t length {};
+        ::std::size_t done {};
+        bool busy {};
+    };
+
+    inline bool setup( unsigned entries );
+    inline void teardown() noexcept;
+    inline bool submit();
+    inline bool enqueue( unsigned index );
+    inline bool reap( bool wait );
+    inline bool enter( unsigned submit , unsigned complete , unsigned flags );
+
+    int m_fd;
+    int m_ring { -1 };
+    ::std::size_t m_buffer_size;
+    ::std::vector<block> m_blocks;
+    unsigned m_current {};
+    unsigned m_inflight {};
+    ::std::size_t m_position {};
+    bool m_failed {};
+
+    void* m_sq_map { MAP_FAILED };
+    void* m_cq_map { MAP_FAILED };
+    ::std::size_t m_sq_map_size {};
+    ::std::size_t m_cq_map_size {};
+    ::io_uring_sqe* m_sqes { static_cast<::io_uring_sqe*>( MAP_FAILED ) };
+    ::std::size_t m_sqes_size {};
+
+    unsigned* m_sq_tail {};
+    unsigned* m_sq_mask {};
+    unsigned* m_sq_array {};
+    unsigned* m_cq_head {};
+    unsigned* m_cq_tail {};
+    unsigned* m_cq_mask {};
+    ::io_uring_cqe* m_cqes {};
+};
+
+#endif
+
+}
+
+// An output stream which writes straight to a POSIX file descriptor such as
+// 'STDOUT_FILENO', a file or a pipe, without a 'FILE' or 'std::filebuf' in
+// between. It can be registered to a printer like any other stream.
+class fd_sink : public ::std::ostream
+{
+public:
+
+    static constexpr ::std::size_t default_buffer_size { 1 << 16 };
+
+    inline explicit fd_sink( int fd , ::std::size_t buffer_size = default_buffer_size );
+    inline explicit fd_sink( const char* path , ::std::size_t buffer_size = default_buffer_size );
+
+    int fd() const noexcept
+    {
+        return m_buffer.fd();
+    }
+
+private:
+
+    inline fd_sink( int fd , ::std::size_t buffer_size , bool owned );
+
+    detail::fd_buffer m_buffer;
+};
+
+// An output stream which copies rows straight into a memory mapping of the
+// output file instead of issuing a system call per buffer. The file grows in
+// chunks of 'chunk_size' bytes and is truncated to the exact size written on
+// destruction, until then it ends with the unused part of the last chunk.
+// A descriptor passed in must be opened for both reading and writing;
+// writing starts at its current offset.
+class mmap_sink : public ::std::ostream
+{
+public:
+
+    static constexpr ::std::size_t default_chunk_size { 1 << 24 };
+
+    inline explicit mmap_sink( int fd , ::std::size_t chunk_size = default_chunk_size );
+    inline explicit mmap_sink( const char* path , ::std::size_t chunk_size = default_chunk_size );
+
+    int fd() const noexcept
+    {
+        return m_buffer.fd();
+    }
+
+private:
+
+    inline mmap_sink( int fd , ::std::size_t chunk_size , bool owned );
+
+    detail::mmap_buffer m_buffer;
+};
+
+// An output stream which writes a file through io_uring, so printing never
+// waits for the disk unless all 'buffer_count' buffers are in flight and
+// 'flush()' only waits for the outstanding writes. It falls back to the
+// plain writes of 'fd_sink' when io_uring is unavailable, e.g. on kernels
+// without it, on non-Linux systems or for descriptors which are not
+// seekable. The fallback can be forced by defining TABLEPRINTER_NO_IO_URING.
+class uring_sink : public ::std::ostream
+{
+public:
+
+    static constexpr ::std::size_t default_buffer_size { 1 << 16 };
+    static constexpr unsigned default_buffer_count { 8 };
+
+    inline explicit uring_sink( int fd , ::std::size_t buffer_size = default_buffer_size , unsigned buffer_count = default_buffer_count );
+    inline explicit uring_sink( const char* path , ::std::size_t buffer_size = default_buffer_size , unsigned buffer_count = default_buffer_count );
+    inline ~uring_sink() override;
+
+    uring_sink( const uring_sink& ) = delete;
+    uring_sink& operator=( const uring_sink& ) = delete;
+
+    int fd() const noexcept
+    {
+        return m_fd;
+    }
+
+    bool uses_io_uring() const noexcept
+    {
+        return m_uses_io_uring;
+    }
+
+private:
+
+    inline uring_sink( int fd , ::std::size_t buffer_size , unsigned buffer_count , bool owned );
+
+    int m_fd;
+    bool m_owned;
+    bool m_uses_io_uring {};
+    ::std::unique_ptr<::std::streambuf> m_buffer;
+};
+
+}
+
+tableprinter::detail::fd_buffer::fd_buffer( int fd , ::std::size_t capacity , bool owned )
+    :   m_fd { fd }
+    ,   m_owned { owned }
+    ,   m_capacity { capacity ? capacity : 1 }
+    ,   m_data { ::std::make_unique<char[]>( m_capacity ) }
+{
+    setp( m_data.get() , m_data.get() + m_capacity );
+}
+
+tableprinter::detail::fd_buffer::~fd_buffer()
+{
+    sync();
+
+    if ( m_owned && m_fd >= 0 )
+        ::close( m_fd );
+}
+
+tableprinter::detail::fd_buffer::int_type tableprinter::detail::fd_buffer::overflow( int_type ch )
+{
+    if ( sync() != 0 )
+        return traits_type::eof();
+
+    if ( !traits_type::eq_int_type( ch , traits_type::eof() ) )
+    {
+        *pptr() = traits_type::to_char_type( ch );
+        pbump( 1 );
+    }
+
+    return traits_type::not_eof( ch );
+}
+
+::std::streamsize tableprinter::detail::fd_buffer::xsputn( const char* s , ::std::streamsize n )
+{
+    if ( n <= epptr() - pptr() )
+    {
+        ::std::memcpy( pptr() , s , ::std::size_t( n ) );
+        pbump( int( n ) );
+
+        return n;
+    }
+
+    ::iovec iov[] = {
+        { pbase() , ::std::size_t( pptr() - pbase() ) } ,
+        { const_cast<char*>( s ) , ::std::size_t( n ) }
+    };
+
+    setp( m_data.get() , m_data.get() + m_capacity );
+
+    return write_all( iov , 2 ) ? n : 0;
+}
+
+int tableprinter::detail::fd_buffer::sync()
+{
+    if ( pptr() == pbase() )
+        return 0;
+
+    ::iovec iov { pbase() , ::std::size_t( pptr() - pbase() ) };
+
+    setp( m_data.get() , m_data.get() + m_capacity );
+
+    return write_all( &iov , 1 ) ? 0 : -1;
+}
+
+bool tableprinter::detail::fd_buffer::write_all( ::iovec* iov , int count )
+{
+    if ( m_fd < 0 )
+        return false;
+
+    while ( count )
+    {
+        const auto written { ::writev( m_fd , iov , count ) };
+
+        if ( written < 0 )
+        {
+            if ( errno == EINTR )
+                continue;
+
+            return false;
+        }
+
+        auto left { ::std::size_t( written ) };
+
+        while ( count && left >= iov->iov_len )
+        {
+            left -= iov->iov_len;
+            ++iov;
+            --count;
+        }
+
+        if ( count )
+        {
+            iov->iov_base = static_cast<char*>( iov->iov_base ) + left;
+            iov->iov_len -= left;
+        }
+    }
+
+    return true;
+}
+
+tableprinter::detail::mmap_buffer::mmap_buffer( int fd , ::std::size_t chunk , bool owned )
+    :   m_fd { fd }
+    ,   m_owned { owned }
+    ,   m_chunk { chunk ? chunk : 1 }
+    ,   m_page { ::std::size_t( ::sysconf( _SC_PAGESIZE ) ) }
+{
+    if ( m_fd < 0 )
+        return;
+
+    const auto position { ::lseek( m_fd , 0 , SEEK_CUR ) };
+
+    if ( position > 0 )
+        m_size = ::std::size_t( position );
+}
+
+tableprinter::detail::mmap_buffer::~mmap_buffer()
+{
+    if ( m_fd < 0 )
+        return;
+
+    if ( m_map )
+    {
+        unmap();
+
+        if ( ::ftruncate( m_fd , ::off_t( m_size ) ) == 0 )
+            ::lseek( m_fd , ::off_t( m_size ) , SEEK_SET );
+    }
+
+    if ( m_owned )
+        ::close( m_fd );
+}
+
+tableprinter::detail::mmap_buffer::int_type tableprinter::detail::mmap_buffer::overflow( int_type ch )
+{
+    if ( traits_type::eq_int_type( ch , traits_type::eof() ) )
+        return traits_type::not_eof( ch );
+
+    if ( !grow( 1 ) )
+        return traits_type::eof();
+
+    *pptr() = traits_type::to_char_type( ch );
+    pbump( 1 );
+
+    return ch;
+}
+
+::std::streamsize tableprinter::detail::mmap_buffer::xsputn( const char* s , ::std::streamsize n )
+{
+    if ( n > epptr() - pptr() && !grow( ::std::size_t( n ) ) )
+        return 0;
+
+    ::std::memcpy( pptr() , s , ::std::size_t( n ) );
+
+    // 'pbump' takes an 'int', larger writes advance in several steps.
+    for ( auto left { n }; left > 0; )
+    {
+        const auto step { int( ::std::min<::std::streamsize>( left , ::std::numeric_limits<int>::max() ) ) };
+
+        pbump( step );
+        left -= step;
+    }
+
+    return n;
+}
+
+int tableprinter::detail::mmap_buffer::sync()
+{
+    return m_fd < 0 ? -1 : 0;
+}
+
+bool tableprinter::detail::mmap_buffer::grow( ::std::size_t n )
+{
+    if ( m_fd < 0 )
+        return false;
+
+    unmap();
+
+    m_offset = m_size / m_page * m_page;
+    m_length = ( m_size - m_offset + ::std::max( n , m_chunk ) + m_page - 1 ) / m_page * m_page;
+
+    if ( ::ftruncate( m_fd , ::off_t( m_offset + m_length ) ) != 0 )
+        return false;
+
+    auto map { ::mmap( nullptr , m_length , PROT_READ | PROT_WRITE , MAP_SHARED , m_fd , ::off_t( m_offset ) ) };
+
+    if ( map == MAP_FAILED )
+        return false;
+
+    m_map = static_cast<char*>( map );
+    setp( m_map , m_map + m_length );
+    pbump( int( m_size - m_offset ) );
+
+    return true;
+}
+
+void tableprinter::detail::mmap_buffer::unmap()
+{
+    if ( !m_map )
+        return;
+
+    m_size = m_offset + ::std::size_t( pptr() - m_map );
+    ::munmap( m_map , m_length );
+    m_map = nullptr;
+    setp( nullptr , nullptr );
+}
+
+tableprinter::fd_sink::fd_sink( int fd , ::std::size_t buffer_size )
+    :   fd_sink { fd , buffer_size , false }
+{   }
+
+tableprinter::fd_sink::fd_sink( const char* path , ::std::size_t buffer_size )
+    :   fd_sink { ::open( path , O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC , 0644 ) , buffer_size , true }
+{   }
+
+tableprinter::fd_sink::fd_sink( int fd , ::std::size_t buffer_size , bool owned )
+    :   ::std::ostream { nullptr }
+    ,   m_buffer { fd , buffer_size , owned }
+{
+    rdbuf( &m_buffer );
+
+    if ( fd < 0 )
+        setstate( ::std::ios_base::badbit );
+}
+
+tableprinter::mmap_sink::mmap_sink( int fd , ::std::size_t chunk_size )
+    :   mmap_sink { fd , chunk_size , false }
+{   }
+
+tableprinter::mmap_sink::mmap_sink( const char* path , ::std::size_t chunk_size )
+    :   mmap_sink { ::open( path , O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC , 0644 ) , chunk_size , true }
+{   }
+
+tableprinter::mmap_sink::mmap_sink( int fd , ::std::size_t chunk_size , bool owned )
+    :   ::std::ostream { nullptr }
+    ,   m_buffer { fd , chunk_size , owned }
+{
+    rdbuf( &m_buffer );
+
+    if ( fd < 0 )
+        setstate( ::std::ios_base::badbit );
+}
+
+#ifdef TABLEPRINTER_IO_URING
+
+tableprinter::detail::uring_buffer::uring_buffer( int fd , ::std::size_t buffer_size , unsigned buffer_count )
+    :   m_fd { fd }
+    ,   m_buffer_size { buffer_size ? buffer_size : 1 }
+    ,   m_blocks( buffer_count ? buffer_count : 1 )
+{
+    const auto position { ::lseek( m_fd , 0 , SEEK_CUR ) };
+
+    if ( m_fd < 0 || position < 0 )
+        return;
+
+    m_position = ::std::size_t( position );
+
+    for ( auto& b : m_blocks )
+        b.data = ::std::make_unique<char[]>( m_buffer_size );
+
+    if ( !setup( unsigned( m_blocks.size() ) ) )
+    {
+        teardown();
+        return;
+    }
+
+    setp( m_blocks.front().data.get() , m_blocks.front().data.get() + m_buffer_size );
+}
+
+tableprinter::detail::uring_buffer::~uring_buffer()
+{
+    if ( valid() )
+        sync();
+
+    teardown();
+}
+
+tableprinter::detail::uring_buffer::int_type tableprinter::detail::uring_buffer::overflow( int_type ch )
+{
+    if ( !submit() )
+        return traits_type::eof();
+
+    if ( !traits_type::eq_int_type( ch , traits_type::eof() ) )
+    {
+        *pptr() = traits_type::to_char_type( ch );
+        pbump( 1 );
+    }
+
+    return traits_type::not_eof( ch );
+}
+
+::std::streamsize tableprinter::detail::uring_buffer::xsputn( const char* s , ::std::streamsize n )
+{
+    auto left { n };
+
+    while ( left )
+    {
+        if ( pptr() == epptr() && !submit() )
+            return n - left;
+
+        const auto count { ::std::min( left , ::std::streamsize( epptr() - pptr() ) ) };
+
+        ::std::memcpy( pptr() , s , ::std::size_t( count ) );
+        pbump( int( count ) );
+        s += count;
+        left -= count;
+    }
+
+    return n;
+}
+
+int tableprinter::detail::uring_buffer::sync()
+{
+    const auto submitted { submit() };
+
+    while ( m_inflight && reap( true ) );
+
+    return submitted && !m_failed ? 0 : -1;
+}
+
+bool tableprinter::detail::uring_buffer::setup( unsigned entries )
+{
+    ::io_uring_params params {};
+
+    m_ring = int( ::syscall( __NR_io_uring_setup , entries , &params ) );
+
+    if ( m_ring < 0 )
+        return false;
+
+    m_sq_map_size = params.sq_off.array + params.sq_entries * sizeof( unsigned );
+    m_cq_map_size = params.cq_off.cqes + params.cq_entries * sizeof( ::io_uring_cqe );
+
+    if ( params.features & IORING_FEAT_SINGLE_MMAP )
+        m_sq_map_size = m_cq_map_size = ::std::max( m_sq_map_size , m_cq_map_size );
+
+    m_sq_map = ::mmap( nullptr , m_sq_map_size , PROT_READ | PROT_WRITE , MAP_SHARED | MAP_POPULATE , m_ring , IORING_OFF_SQ_RING );
+
+    if ( m_sq_map == MAP_FAILED )
+        return false;
+
+    m_cq_map = params.features & IORING_FEAT_SINGLE_MMAP ?
+        m_sq_map :
+        ::mmap( nullptr , m_cq_map_size , PROT_READ | PROT_WRITE , MAP_SHARED | MAP_POPULATE , m_ring , IORING_OFF_CQ_RING );
+
+    if ( m_cq_map == MAP_FAILED )
+        return false;
+
+    m_sqes_size = params.sq_entries * sizeof( ::io_uring_sqe );
+
+    auto sqes { ::mmap( nullptr , m_sqes_size , PROT_READ | PROT_WRITE , MAP_SHARED | MAP_POPULATE , m_ring , IORING_OFF_SQES ) };
+
+    if ( sqes == MAP_FAILED )
+        return false;
+
+    m_sqes = static_cast<::io_uring_sqe*>( sqes );
+
+    auto sq { static_cast<char*>( m_sq_map ) };
+    auto cq { static_cast<char*>( m_cq_map ) };
+
+    m_sq_tail = reinterpret_cast<unsigned*>( sq + params.sq_off.tail );
+    m_sq_mask = reinterpret_cast<unsigned*>( sq + params.sq_off.ring_mask );
+    m_sq_array = reinterpret_cast<unsigned*>( sq + params.sq_off.array );
+    m_cq_head = reinterpret_cast<unsigned*>( cq + params.cq_off.head );
+    m_cq_tail = reinterpret_cast<unsigned*>( cq + params.cq_off.tail );
+    m_cq_mask = reinterpret_cast<unsigned*>( cq + params.cq_off.ring_mask );
+    m_cqes = reinterpret_cast<::io_uring_cqe*>( cq + params.cq_off.cqes );
+
+    ::std::vector<::iovec> iovs;
+    iovs.reserve( m_blocks.size() );
+
+    for ( auto& b : m_blocks )
+        iovs.push_back( { b.data.get() , m_buffer_size } );
+
+    return ::syscall( __NR_io_uring_register , m_ring , IORING_REGISTER_BUFFERS , iovs.data() , unsigned( iovs.size() ) ) == 0;
+}
+
+void tableprinter::detail::uring_buffer::teardown() noexcept
+{
+    if ( m_sqes != MAP_FAILED )
+        ::munmap( m_sqes , m_sqes_size );
+
+    if ( m_cq_map != MAP_FAILED && m_cq_map != m_sq_map )
+        ::munmap( m_cq_map , m_cq_map_size );
+
+    if ( m_sq_map != MAP_FAILED )
+        ::munmap( m_sq_map , m_sq_map_size );
+
+    if ( m_ring >= 0 )
+        ::close( m_ring );
+
+    m_sqes = static_cast<::io_uring_sqe*>( MAP_FAILED );
+    m_sq_map = m_cq_map = MAP_FAILED;
+    m_ring = -1;
+    setp( nullptr , nullptr );
+}
+
+bool tableprinter::detail::uring_buffer::submit()
+{
+    if ( !valid() || m_failed )
+        return false;
+
+    auto& current { m_blocks[ m_current ] };
+    const auto length { ::std::size_t( pptr() - pbase() ) };
+
+    if ( !length )
+        return true;
+
+    current.offset = m_position;
+    current.length = length;
+    current.done = 0;
+    current.busy = true;
+    m_position += length;
+    ++m_inflight;
+
+    if ( !enqueue( m_current ) )
+        return false;
+
+    m_current = ( m_current + 1 ) % unsigned( m_blocks.size() );
+
+    while ( m_blocks[ m_current ].busy )
+        if ( !reap( true ) )
+            return false;
+
+    auto data { m_blocks[ m_current ].data.get() };
+    setp( data , data + m_buffer_size );
+
+    return !m_failed;
+}
+
+bool tableprinter::detail::uring_buffer::enqueue( unsigned index )
+{
+    const auto& b { m_blocks[ index ] };
+    const auto tail { *m_sq_tail };
+    const auto slot { tail & *m_sq_mask };
+    auto& sqe { m_sqes[ slot ] };
+
+    sqe = {};
+    sqe.opcode = IORING_OP_WRITE_FIXED;
+    sqe.fd = m_fd;
+    sqe.off = b.offset + b.done;
+    sqe.addr = reinterpret_cast<::std::uintptr_t>( b.data.get() + b.done );
+    sqe.len = unsigned( b.length - b.done );
+    sqe.buf_index = ::std::uint16_t( index );
+    sqe.user_data = index;
+
+    m_sq_array[ slot ] = slot;
+    __atomic_store_n( m_sq_tail , tail + 1 , __ATOMIC_RELEASE );
+
+    return enter( 1 , 0 , 0 );
+}
+
+bool tableprinter::detail::uring_buffer::reap( bool wait )
+{
+    if ( wait && !enter( 0 , 1 , IORING_ENTER_GETEVENTS ) )
+        return false;
+
+    auto head { *m_cq_head };
+    const auto tail { __atomic_load_n( m_cq_tail , __ATOMIC_ACQUIRE ) };
+
+    for ( ; head != tail ; ++head )
+    {
+        const auto& cqe { m_cqes[ head & *m_cq_mask ] };
+        auto& b { m_blocks[ cqe.user_data ] };
+
+        // Blocks are never empty, a write making no progress would be
+        // submitted again forever and fails the buffer instead.
+        if ( cqe.res > 0 )
+            b.done += ::std::size_t( cqe.res );
+        else if ( cqe.res == 0 || ( cqe.res != -EINTR && cqe.res != -EAGAIN ) )
+            m_failed = true;
+
+        if ( !m_failed && b.done < b.length )
+        {
+            __atomic_store_n( m_cq_head , head + 1 , __ATOMIC_RELEASE );
+
+            if ( !enqueue( unsigned( cqe.user_data ) ) )
+                return false;
+
+            continue;
+        }
+
+        b.busy = false;
+        --m_inflight;
+    }
+
+    __atomic_store_n( m_cq_head , head , __ATOMIC_RELEASE );
+
+    return true;
+}
+
+bool tableprinter::detail::uring_buffer::enter( unsigned submit , unsigned complete , unsigned flags )
+{
+    while ( ::syscall( __NR_io_uring_enter , m_ring , submit , complete , flags , nullptr , 0 ) < 0 )
+    {
+        if ( errno != EINTR && errno != EAGAIN && errno != EBUSY )
+        {
+            m_failed = true;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+#endif
+
+tableprinter::uring_sink::uring_sink( int fd , ::std::size_t buffer_size , unsigned buffer_count )
+    :   uring_sink { fd , buffer_size , buffer_count , false }
+{   }
+
+tableprinter::uring_sink::uring_sink( const char* path , ::std::size_t buffer_size , unsigned buffer_count )
+    :   uring_sink { ::open( path , O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC , 0644 ) , buffer_size , buffer_count , true }
+{   }
+
+tableprinter::uring_sink::uring_sink( int fd , ::std::size_t buffer_size , unsigned buffer_count , bool owned )
+    :   ::std::ostream { nullptr }
+    ,   m_fd { fd }
+    ,   m_owned { owned }
+{
+#ifdef TABLEPRINTER_IO_URING
+    auto ring { ::std::make_unique<detail::uring_buffer>( fd , buffer_size , buffer_count ) };
+
+    if ( ring->valid() )
+    {
+        m_uses_io_uring = true;
+        m_buffer = ::std::move( ring );
+    }
+#else
+    static_cast<void>( buffer_count );
+#endif
+
+    if ( !m_buffer )
+        m_buffer = ::std::make_unique<detail::fd_buffer>( fd , buffer_size , false );
+
+    rdbuf( m_buffer.get() );
+
+    if ( fd < 0 )
+        setstate( ::std::ios_base::badbit );
+}
+
+tableprinter::uring_sink::~uring_sink()
+{
+    m_buffer.reset();
+
+    if ( m_owned && m_fd >= 0 )
+        ::close( m_fd );
+}
+
+#endif
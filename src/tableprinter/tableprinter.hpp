@@ -8,7 +8,44 @@
 #include <iomanip>
 #include <ostream>
 #include <tuple>
+#include <utility>
 #include <sstream>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <new>
+#include <array>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+// The sinks and the reader use POSIX files and mappings where available.
+#if defined( __unix__ ) || defined( __APPLE__ )
+#define TABLEPRINTER_POSIX
+#endif
+
+#if !defined( TABLEPRINTER_NO_SIMD ) &&                                 \
+    ( defined( __SSE2__ ) || defined( _M_X64 ) ||                       \
+      ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 ) )
+#define TABLEPRINTER_SSE2
+#include <emmintrin.h>
+#if defined( _MSC_VER ) && !defined( __clang__ )
+#include <intrin.h>
+#endif
+#endif
+#include <type_traits>
+#if defined( TABLEPRINTER_USE_PMR ) && __has_include( <memory_resource> )
+#include <memory_resource>
+#if defined( __cpp_lib_memory_resource )
+#define TABLEPRINTER_PMR
+#endif
+#endif
 
 namespace tableprinter
 {
@@ -25,32 +62,32 @@ struct name
 
 struct width
 {
-    explicit width( int val ) : value { val }
+    constexpr explicit width( int val ) : value { val }
     {}
 
     int value;
 
-    operator int() const noexcept { return value; }
+    constexpr operator int() const noexcept { return value; }
 };
 
 struct fill
 {
-    explicit fill( char val ) : value { val }
+    constexpr explicit fill( char val ) : value { val }
     {}
 
     char value;
 
-    operator char() const noexcept { return value; }
+    constexpr operator char() const noexcept { return value; }
 };
 
 struct precision
 {
-    explicit precision( int val ) : value { val } 
+    constexpr explicit precision( int val ) : value { val } 
     {}
 
     int value;
 
-    operator int() const noexcept { return value; }
+    constexpr operator int() const noexcept { return value; }
 };
 
 struct default_precision
@@ -77,6 +114,12 @@ struct decimal
 struct octal
 {};
 
+// Widens the column to its longest cell printed so far. The width only
+// grows, a 'width' option of the same column is used as the minimum. Rows
+// printed to each stream with their own locale widen that stream only.
+struct auto_width
+{};
+
 using option = ::std::variant<name ,
                               width ,
                               precision ,
@@ -88,11 +131,55 @@ using option = ::std::variant<name ,
                               right ,
                               hex ,
                               decimal ,
-                              octal>;
+                              octal ,
+                              auto_width>;
+
+template<int N>
+struct static_width
+{
+    static constexpr width option { N };
+};
+
+template<char C>
+struct static_fill
+{
+    static constexpr fill option { C };
+};
+
+template<int N>
+struct static_precision
+{
+    static constexpr precision option { N };
+};
+
+template<const char* Name>
+struct static_name
+{
+    static constexpr ::std::string_view value { Name };
+};
 
 namespace detail
 {
 
+// Containers of the printer's internals. They draw from a memory resource
+// when TABLEPRINTER_USE_PMR is defined and the standard library provides
+// 'std::pmr', and are the usual 'std' ones otherwise.
+#ifdef TABLEPRINTER_PMR
+using allocator = ::std::pmr::polymorphic_allocator<::std::byte>;
+
+template<typename T>
+using vector = ::std::pmr::vector<T>;
+
+using string = ::std::pmr::string;
+#else
+using allocator = ::std::allocator<::std::byte>;
+
+template<typename T>
+using vector = ::std::vector<T>;
+
+using string = ::std::string;
+#endif
+
 template<typename... Ts>
 struct overloaded : Ts...
 {
@@ -114,7 +201,8 @@ struct is_option :
                             ::std::is_same_v<T , right>             ||
                             ::std::is_same_v<T , hex>               ||
                             ::std::is_same_v<T , decimal>           ||
-                            ::std::is_same_v<T , octal>>
+                            ::std::is_same_v<T , octal>             ||
+                            ::std::is_same_v<T , auto_width>>
 {};
 
 template<typename T>
@@ -133,7 +221,8 @@ struct invocable_with_option :
                             ::std::is_invocable_v<F , right>             ||
                             ::std::is_invocable_v<F , hex>               ||
                             ::std::is_invocable_v<F , decimal>           ||
-                            ::std::is_invocable_v<F , octal>>
+                            ::std::is_invocable_v<F , octal>             ||
+                            ::std::is_invocable_v<F , auto_width>>
 {};
 
 template<typename F>
@@ -210,6 +299,197 @@ struct is_container< T ,
 template<typename T>
 static constexpr bool is_container_v = is_container<T>::value;
 
+// Options of a column. The first 'inline_capacity' options are stored in
+// the list itself, so a column does not allocate unless it has more.
+class option_list
+{
+public:
+
+    using value_type     = option;
+    using iterator       = option*;
+    using const_iterator = const option*;
+
+    static constexpr ::std::size_t inline_capacity { 6 };
+
+    option_list() noexcept = default;
+
+    option_list( ::std::initializer_list<option> opts )
+    {
+        reserve( opts.size() );
+
+        for ( const option& opt : opts )
+            push_back( opt );
+    }
+
+    option_list( const option_list& other )
+    {
+        reserve( other.m_size );
+
+        for ( const option& opt : other )
+            push_back( opt );
+    }
+
+    option_list( option_list&& other ) noexcept
+    {
+        take( other );
+    }
+
+    option_list& operator=( const option_list& other )
+    {
+        if ( this != &other )
+        {
+            option_list copy { other };
+
+            clear();
+            take( copy );
+        }
+
+        return *this;
+    }
+
+    option_list& operator=( option_list&& other ) noexcept
+    {
+        if ( this != &other )
+        {
+            clear();
+            take( other );
+        }
+
+        return *this;
+    }
+
+    ~option_list()
+    {
+        clear();
+    }
+
+    void push_back( const option& opt )
+    {
+        emplace_back( opt );
+    }
+
+    void push_back( option&& opt )
+    {
+        emplace_back( ::std::move( opt ) );
+    }
+
+    template<typename... Args>
+    option& emplace_back( Args&&... args )
+    {
+        if ( m_size == m_capacity )
+            reserve( m_capacity * 2 );
+
+        auto* opt { new ( m_data + m_size ) option ( ::std::forward<Args>( args )... ) };
+
+        ++m_size;
+
+        return *opt;
+    }
+
+    void reserve( ::std::size_t capacity )
+    {
+        if ( capacity <= m_capacity )
+            return;
+
+        auto* data { static_cast<option*>( ::operator new( capacity * sizeof( option ) ) ) };
+
+        relocate( data );
+        m_data = data;
+        m_capacity = capacity;
+    }
+
+    void clear() noexcept
+    {
+        destroy();
+
+        if ( !local() )
+            ::operator delete( m_data );
+
+        m_data = storage();
+        m_capacity = inline_capacity;
+    }
+
+    ::std::size_t size() const noexcept { return m_size; }
+    bool empty() const noexcept { return !m_size; }
+
+    option* data() noexcept { return m_data; }
+    const option* data() const noexcept { return m_data; }
+
+    option& operator[]( ::std::size_t idx ) noexcept { return m_data[ idx ]; }
+    const option& operator[]( ::std::size_t idx ) const noexcept { return m_data[ idx ]; }
+
+    iterator begin() noexcept { return m_data; }
+    iterator end() noexcept { return m_data + m_size; }
+    const_iterator begin() const noexcept { return m_data; }
+    const_iterator end() const noexcept { return m_data + m_size; }
+
+private:
+
+    option* storage() noexcept
+    {
+        return reinterpret_cast<option*>( m_storage );
+    }
+
+    bool local() const noexcept
+    {
+        return m_data == reinterpret_cast<const option*>( m_storage );
+    }
+
+    void destroy() noexcept
+    {
+        for ( ::std::size_t i {}; i < m_size; ++i )
+            m_data[ i ].~option();
+
+        m_size = 0;
+    }
+
+    // Moves the options into 'data', leaving this list empty.
+    void relocate( option* data ) noexcept
+    {
+        const auto count { m_size };
+
+        for ( ::std::size_t i {}; i < count; ++i )
+            new ( data + i ) option ( ::std::move( m_data[ i ] ) );
+
+        destroy();
+
+        if ( !local() )
+            ::operator delete( m_data );
+
+        m_size = count;
+    }
+
+    // Takes the options of 'other' into this empty list, leaving 'other'
+    // empty.
+    void take( option_list& other ) noexcept
+    {
+        if ( other.local() )
+        {
+            m_size = other.m_size;
+
+            for ( ::std::size_t i {}; i < m_size; ++i )
+                new ( m_data + i ) option ( ::std::move( other.m_data[ i ] ) );
+
+            other.destroy();
+
+            return;
+        }
+
+        m_data = other.m_data;
+        m_size = other.m_size;
+        m_capacity = other.m_capacity;
+
+        other.m_data = other.storage();
+        other.m_size = 0;
+        other.m_capacity = inline_capacity;
+    }
+
+    alignas( option ) unsigned char m_storage[ inline_capacity * sizeof( option ) ];
+    option* m_data { storage() };
+    ::std::size_t m_size {};
+    ::std::size_t m_capacity { inline_capacity };
+};
+
 template<typename F>
 inline void run( F val , const option& opt )
 {
@@ -228,18 +508,18 @@ inline void run( F val , const option& opt )
 }
 
 template<typename F>
-inline void run( F val , const ::std::vector<option>& options )
+inline void run( F val , const option_list& options )
 {
     for ( const option& opt : options )
         run( val , opt );
 }
 
 template<typename Opt>
-inline ::std::vector<option> filter_opts( const ::std::vector<option>& options )
+inline option_list filter_opts( const option_list& options )
 {
     static_assert( is_option_v<Opt> , "T must be an option." );
 
-    ::std::vector<option> filtered;
+    option_list filtered;
 
     for ( const option& opt : options )
     {
@@ -258,7 +538,7 @@ inline ::std::vector<option> filter_opts( const ::std::vector<option>& options )
     return filtered;
 }
 
-inline ::std::string concat( const ::std::vector<option>& options )
+inline ::std::string concat( const option_list& options )
 {
     ::std::stringstream ss;
 
@@ -283,286 +563,2838 @@ inline ::std::string concat( const ::std::vector<option>& options )
     return ss.str();
 };
 
-}
+template<typename T , typename Variant>
+struct variant_index;
 
-struct printer_exception : ::std::logic_error
+template<typename T , typename... Ts>
+struct variant_index<T , ::std::variant<Ts...>>
 {
-    using ::std::logic_error::logic_error;
+    static constexpr ::std::size_t find()
+    {
+        constexpr bool matches[] = { ::std::is_same_v<T , Ts>... };
+
+        ::std::size_t idx {};
+
+        while ( !matches[ idx ] )
+            ++idx;
+
+        return idx;
+    }
+
+    static constexpr ::std::size_t value = find();
 };
 
-struct arguments_size_doesnt_match_with_columns : printer_exception
+template<typename T>
+static constexpr ::std::size_t option_index_v = variant_index<T , option>::value;
+
+// Counts the options of a column by their kind in a single pass,
+// without allocating.
+class option_counts
 {
-    using printer_exception::printer_exception;
+public:
+
+    explicit option_counts( const option_list& options ) noexcept
+    {
+        for ( const option& opt : options )
+            ++m_counts[ opt.index() ];
+    }
+
+    template<typename Opt>
+    ::std::size_t of() const noexcept
+    {
+        static_assert( is_option_v<Opt> , "T must be an option." );
+
+        return m_counts[ option_index_v<Opt> ];
+    }
+
+private:
+
+    ::std::array<::std::size_t , ::std::variant_size_v<option>> m_counts {};
 };
 
-struct duplicate_option : printer_exception
+struct column_plan
 {
-    using printer_exception::printer_exception;
+    int                         width;
+    int                         precision;
+    char                        fill;
+    bool                        has_width;
+    bool                        has_precision;
+    bool                        has_fill;
+    bool                        auto_width;
+    ::std::ios_base::fmtflags   flags;
+    ::std::ios_base::fmtflags   mask;
 };
 
-struct both_left_and_right_option : printer_exception
+constexpr void set_flags( column_plan& plan , ::std::ios_base::fmtflags flags , ::std::ios_base::fmtflags mask )
 {
-    using printer_exception::printer_exception;
-};
+    plan.flags = ( plan.flags & ~mask ) | ( flags & mask );
+    plan.mask  = plan.mask | mask;
+}
 
-struct both_precision_and_default_precision : printer_exception
+constexpr void compile_option( column_plan& , const name& )
+{}
+
+constexpr void compile_option( column_plan& plan , const width& w )
 {
-    using printer_exception::printer_exception;
-};
+    plan.width     = w.value;
+    plan.has_width = true;
+}
 
-struct both_fixed_and_unfixed : printer_exception
+constexpr void compile_option( column_plan& plan , const fill& f )
 {
-    using printer_exception::printer_exception;
-};
+    plan.fill     = f.value;
+    plan.has_fill = true;
+}
 
-template<typename Iter>
-inline auto sequence( Iter beg , Iter end )
+constexpr void compile_option( column_plan& plan , const precision& p )
 {
-    static_assert(
-        detail::is_input_iter_v<Iter> ,
-        "'Iter' should support ++,*,!="
-    );
+    plan.precision     = p.value;
+    plan.has_precision = true;
+}
 
-    return detail::sequence<Iter> { beg , end };
+constexpr void compile_option( column_plan& plan , const default_precision& )
+{
+    plan.precision     = 6;
+    plan.has_precision = true;
 }
 
-template<typename Container>
-inline auto sequence( Container&& c )
+constexpr void compile_option( column_plan& plan , const fixed& )
 {
-    static_assert(
-        detail::is_container_v<Container> ,
-        "'Container' should have 'begin()' and 'end()'"
-    );
+    set_flags( plan , ::std::ios_base::fixed , ::std::ios_base::floatfield );
+}
 
-    using Iterator = decltype( ::std::begin( c ) );
+constexpr void compile_option( column_plan& plan , const unfixed& )
+{
+    set_flags( plan , ::std::ios_base::fmtflags {} , ::std::ios_base::fixed );
+}
 
-    return detail::sequence<Iterator> {
-        ::std::begin( c ) ,
-        ::std::end( c )
-    };
+constexpr void compile_option( column_plan& plan , const left& )
+{
+    set_flags( plan , ::std::ios_base::left , ::std::ios_base::adjustfield );
 }
 
-struct column
+constexpr void compile_option( column_plan& plan , const right& )
+{
+    set_flags( plan , ::std::ios_base::right , ::std::ios_base::adjustfield );
+}
+
+constexpr void compile_option( column_plan& plan , const hex& )
+{
+    set_flags( plan , ::std::ios_base::hex , ::std::ios_base::basefield );
+}
+
+constexpr void compile_option( column_plan& plan , const decimal& )
+{
+    set_flags( plan , ::std::ios_base::dec , ::std::ios_base::basefield );
+}
+
+constexpr void compile_option( column_plan& plan , const octal& )
 {
-    column( ::std::initializer_list<option> opts )
+    set_flags( plan , ::std::ios_base::oct , ::std::ios_base::basefield );
+}
+
+constexpr void compile_option( column_plan& plan , const auto_width& )
+{
+    plan.auto_width = true;
+}
+
+inline column_plan compile( const option_list& options )
+{
+    column_plan plan {};
+
+    for ( const option& opt : options )
     {
-        copy(
-            begin ( opts ) ,
-            end( opts ) ,
-            back_inserter( options )
+        visit(
+            [ &plan ]( const auto& opt )
+            {
+                compile_option( plan , opt );
+            } ,
+            opt
         );
     }
 
-    ::std::vector<option> options;
+    return plan;
+}
+
+template<typename T>
+struct static_option
+{
+    using type = T;
 };
 
-class printer
+template<int N>
+struct static_option<static_width<N>>
 {
-public:
+    using type = width;
+};
 
-    using osref = ::std::reference_wrapper<::std::ostream>;
+template<char C>
+struct static_option<static_fill<C>>
+{
+    using type = fill;
+};
 
-    inline explicit printer(
-        ::std::vector<column> columns ,
-        ::std::vector<osref>  streams = ::std::vector<osref> {}
-    );
+template<int N>
+struct static_option<static_precision<N>>
+{
+    using type = precision;
+};
 
-    inline explicit printer(
-        ::std::vector<column> columns ,
-        ::std::ostream& stream
-    );
+template<const char* Name>
+struct static_option<static_name<Name>>
+{
+    using type = name;
+};
 
-    template<typename... Ts>
-    inline printer& add_streams( ::std::ostream& os , Ts&... streams );
+template<typename T>
+using static_option_t = typename static_option<T>::type;
 
-    template<typename... Ts>
-    inline printer& remove_streams( ::std::ostream& os , Ts&... streams );
+template<typename Option>
+constexpr void compile_static_option( column_plan& plan )
+{
+    static_assert(
+        is_option_v<static_option_t<Option>> ,
+        "Option must be an option."
+    );
 
-    template<typename... Ts>
-    inline printer& print( const ::std::tuple<Ts...>& values );
+    static_assert(
+        !is_option_v<Option> || !has_value_field_v<Option> ,
+        "Options with a value should be given as "
+        "'static_name', 'static_width', 'static_fill' or 'static_precision'."
+    );
 
-    template<typename... Ts>
-    inline printer& print( const Ts&... );
-    inline printer& echo( ::std::string_view );
-    inline printer& print_headers();
-    inline const printer& sanity_check() const;
-    inline printer& sanity_check();
-    inline printer& flush();
-    inline const ::std::vector<osref>& streams() const noexcept;
+    if constexpr ( ::std::is_same_v<Option , static_option_t<Option>> )
+        compile_option( plan , Option {} );
+    else if constexpr ( !::std::is_same_v<static_option_t<Option> , name> )
+        compile_option( plan , Option::option );
+}
 
-private:
+template<typename... Options>
+constexpr column_plan compile()
+{
+    column_plan plan {};
 
-    template<typename H , typename... T>
-    inline void print_column( int col , ::std::ostream& , const H& , const T&... );
+    ( compile_static_option<Options>( plan ) , ... );
 
-    template<typename... Ts , ::std::size_t... Idx>
-    inline void print_tuple( const ::std::tuple<Ts...>& , ::std::index_sequence<Idx...> );
+    return plan;
+}
 
-    template<typename T>
-    inline void throw_if_duplicate_opt( const column& , ::std::string_view error ) const;
+template<typename Option>
+constexpr ::std::string_view static_name_of()
+{
+    if constexpr ( ::std::is_same_v<static_option_t<Option> , name> )
+        return Option::value;
+    else
+        return {};
+}
 
-    inline void throw_if_both_left_and_right_opt( const column& ) const;
-    inline void throw_if_both_precision_and_default_precision_opt( const column& ) const;
-    inline void throw_if_both_fixed_and_unfixed_opt( const column& ) const;
+template<typename... Options>
+constexpr ::std::string_view static_names_of()
+{
+    ::std::string_view n {};
 
-    ::std::vector<osref> m_streams;
-    ::std::vector<column> m_columns;
-};
+    ( ( n = ::std::is_same_v<static_option_t<Options> , name> ? static_name_of<Options>() : n ) , ... );
 
+    return n;
 }
 
-tableprinter::printer::printer( ::std::vector<column> columns , ::std::vector<osref> streams )
-    :   m_columns { move( columns ) }
-    ,   m_streams { move( streams ) }
-{   }
+// Calls 'f' with the values of a row, either projected from it by
+// 'projections' or, if there are none, unpacked from a tuple-like row.
+template<typename F , typename Row , typename... Projections>
+inline void apply_row( F&& f , const Row& row , const Projections&... projections )
+{
+    if constexpr ( bool( sizeof...( Projections ) ) )
+        f( ::std::invoke( projections , row )... );
+    else
+        ::std::apply( f , row );
+}
 
-tableprinter::printer::printer( ::std::vector<column> columns , ::std::ostream& stream )
+using osref = ::std::reference_wrapper<::std::ostream>;
+
+template<typename Streams , typename... Ts>
+inline void add_streams( Streams& streams , ::std::ostream& os , Ts&... rest )
+{
+    static_assert(
+        (::std::is_convertible_v<Ts& , ::std::ostream&> && ...) ,
+        "Ts should be inherited from 'std::ostream'"
+    );
+
+    streams.push_back( os );
+    ( streams.push_back( rest ) , ... );
+}
+
+template<typename Streams , typename... Ts>
+inline void remove_streams( Streams& streams , ::std::ostream& os , Ts&... rest )
+{
+    static_assert(
+        (::std::is_convertible_v<Ts& , ::std::ostream&> && ...) ,
+        "Ts should be inherited from 'std::ostream'"
+    );
+
+    streams.erase(
+        remove_if(
+            begin( streams ) ,
+            end( streams ) ,
+            [ &os , &rest... ]( const osref& stream ){
+                return &os == &stream.get() ||
+                       ( ( addressof( rest ) == &stream.get() ) || ... );
+            }
+        ) ,
+        end( streams )
+    );
+}
+
+// Moves 'values' into the container the printer keeps them in.
+template<typename T>
+inline vector<T> adopt( ::std::vector<T>&& values )
+{
+    if constexpr ( ::std::is_same_v<vector<T> , ::std::vector<T>> )
+        return ::std::move( values );
+    else
+        return vector<T>( ::std::make_move_iterator( begin( values ) ) , ::std::make_move_iterator( end( values ) ) );
+}
+
+template<typename Streams>
+inline void write( const Streams& streams , ::std::string_view row )
+{
+    for ( ::std::ostream& stream : streams )
+        stream.write( data( row ) , ::std::streamsize( size( row ) ) );
+}
+
+// Marks the streams as failed, as a cell that fails to insert would if it
+// was written to them directly.
+template<typename Streams>
+inline void fail( const Streams& streams )
+{
+    for ( ::std::ostream& stream : streams )
+        stream.setstate( ::std::ios_base::failbit );
+}
+
+inline void apply( const column_plan& plan , ::std::ostream& os )
+{
+    if ( plan.has_width )
+        os.width( plan.width );
+
+    if ( plan.has_fill )
+        os.fill( plan.fill );
+
+    if ( plan.has_precision )
+        os.precision( plan.precision );
+
+    if ( plan.mask )
+        os.setf( plan.flags , plan.mask );
+}
+
+struct format_state
+{
+    ::std::ios_base::fmtflags flags;
+    ::std::streamsize         precision;
+    ::std::streamsize         width;
+    char                      fill;
+};
+
+inline format_state capture( const ::std::ostream& os )
+{
+    return { os.flags() , os.precision() , os.width() , os.fill() };
+}
+
+inline void restore( const format_state& state , ::std::ostream& os )
+{
+    os.flags( state.flags );
+    os.precision( state.precision );
+    os.width( state.width );
+    os.fill( state.fill );
+}
+
+// Width of an 'auto_width' column. It only grows and may be widened by
+// rows formatted on different threads at the same time.
+class running_width
+{
+public:
+
+    explicit running_width( int val = 0 ) noexcept : m_value { val }
+    {}
+
+    running_width( const running_width& other ) noexcept : m_value { other.get() }
+    {}
+
+    running_width& operator=( const running_width& other ) noexcept
+    {
+        m_value.store( other.get() , ::std::memory_order_relaxed );
+
+        return *this;
+    }
+
+    int get() const noexcept
+    {
+        return m_value.load( ::std::memory_order_relaxed );
+    }
+
+    void fit( ::std::size_t val ) noexcept
+    {
+        const auto wanted { int( ::std::min<::std::size_t>( val , ::std::numeric_limits<int>::max() ) ) };
+
+        auto current { get() };
+
+        while ( current < wanted && !m_value.compare_exchange_weak( current , wanted , ::std::memory_order_relaxed ) );
+    }
+
+private:
+
+    ::std::atomic<int> m_value;
+};
+
+template<typename T , typename = ::std::void_t<>>
+struct is_contiguous : ::std::false_type
+{};
+
+template<typename T>
+struct is_contiguous< T ,
+                      ::std::void_t
+                      <
+                         decltype
+                         (
+                             ::std::data( ::std::declval<T>() ) ,
+                             ::std::size( ::std::declval<T>() )
+                         )
+                      >
+                    > : ::std::true_type
+{};
+
+template<typename T>
+static constexpr bool is_contiguous_v = is_contiguous<T>::value;
+
+template<typename T>
+struct is_native :
+       ::std::bool_constant<( ::std::is_integral_v<T>                 &&
+                              !::std::is_same_v<T , bool>             &&
+                              !::std::is_same_v<T , char>             &&
+                              !::std::is_same_v<T , signed char>      &&
+                              !::std::is_same_v<T , unsigned char>    &&
+                              !::std::is_same_v<T , wchar_t>          &&
+                              !::std::is_same_v<T , char16_t>         &&
+                              !::std::is_same_v<T , char32_t> )       ||
+                            ::std::is_floating_point_v<T>>
+{};
+
+template<typename T>
+static constexpr bool is_native_v = is_native<T>::value;
+
+template<typename T>
+struct is_string : ::std::bool_constant<::std::is_same_v<::std::decay_t<T> , const char*> ||
+                                        ::std::is_same_v<::std::decay_t<T> , char*>>
+{};
+
+template<typename Allocator>
+struct is_string<::std::basic_string<char , ::std::char_traits<char> , Allocator>> : ::std::true_type
+{};
+
+template<>
+struct is_string<::std::string_view> : ::std::true_type
+{};
+
+template<typename T>
+static constexpr bool is_string_v = is_string<T>::value;
+
+#ifdef TABLEPRINTER_SSE2
+
+inline unsigned count_trailing_zeros( unsigned val )
+{
+#if defined( _MSC_VER ) && !defined( __clang__ )
+    unsigned long idx;
+    _BitScanForward( &idx , val );
+
+    return unsigned( idx );
+#else
+    return unsigned( __builtin_ctz( val ) );
+#endif
+}
+
+// Splits 'val' < 10^8 into its eight decimal digits, one per 16-bit lane,
+// with multiply-high by reciprocals instead of divisions.
+inline __m128i decimal_digits( ::std::uint32_t val )
+{
+    const __m128i div_10000    = _mm_set1_epi32( int( 0xd1b71759 ) );
+    const __m128i mul_10000    = _mm_set1_epi32( 10000 );
+    const __m128i div_powers   = _mm_setr_epi16( 8389 , 5243 , 13108 , -32768 , 8389 , 5243 , 13108 , -32768 );
+    const __m128i shift_powers = _mm_setr_epi16( 128 , 2048 , 8192 , -32768 , 128 , 2048 , 8192 , -32768 );
+    const __m128i ten          = _mm_set1_epi16( 10 );
+
+    const __m128i abcdefgh = _mm_cvtsi32_si128( int( val ) );
+    const __m128i abcd     = _mm_srli_epi64( _mm_mul_epu32( abcdefgh , div_10000 ) , 45 );
+    const __m128i efgh     = _mm_sub_epi32( abcdefgh , _mm_mul_epu32( abcd , mul_10000 ) );
+    const __m128i v1       = _mm_slli_epi64( _mm_unpacklo_epi16( abcd , efgh ) , 2 );
+    const __m128i v2       = _mm_unpacklo_epi16( v1 , v1 );
+    const __m128i v3       = _mm_unpacklo_epi32( v2 , v2 );
+    const __m128i v4       = _mm_mulhi_epu16( _mm_mulhi_epu16( v3 , div_powers ) , shift_powers );
+    const __m128i v5       = _mm_slli_epi64( _mm_mullo_epi16( v4 , ten ) , 16 );
+
+    return _mm_sub_epi16( v4 , v5 );
+}
+
+// Writes the 16 characters in 'chars' without the leading ones 'skip'
+// marks, keeping at least the last character. Always stores 16 bytes to
+// 'first' so the copy has a fixed size.
+inline char* write_trimmed( char* first , __m128i chars , unsigned skip )
+{
+    alignas( 16 ) char buf[ 32 ] {};
+
+    _mm_store_si128( reinterpret_cast<__m128i*>( buf ) , chars );
+
+    const auto leading { count_trailing_zeros( ~skip | 0x8000u ) };
+
+    ::std::memcpy( first , buf + leading , 16 );
+
+    return first + ( 16 - leading );
+}
+
+// 'val' must be less than 10^16.
+inline char* write_decimal( char* first , ::std::uint64_t val )
+{
+    const auto hi { ::std::uint32_t( val / 100000000 ) };
+    const auto lo { ::std::uint32_t( val % 100000000 ) };
+
+    const __m128i digits = _mm_packus_epi16( decimal_digits( hi ) , decimal_digits( lo ) );
+    const __m128i zeros  = _mm_cmpeq_epi8( digits , _mm_setzero_si128() );
+
+    return write_trimmed(
+        first ,
+        _mm_add_epi8( digits , _mm_set1_epi8( '0' ) ) ,
+        unsigned( _mm_movemask_epi8( zeros ) )
+    );
+}
+
+inline char* write_hex( char* first , ::std::uint64_t val )
+{
+    unsigned char big_endian[ 8 ];
+
+    for ( int i = 0; i < 8; ++i )
+        big_endian[ i ] = static_cast<unsigned char>( val >> ( 56 - 8 * i ) );
+
+    const __m128i bytes   = _mm_loadl_epi64( reinterpret_cast<const __m128i*>( big_endian ) );
+    const __m128i low     = _mm_set1_epi8( 0x0f );
+    const __m128i nibbles = _mm_unpacklo_epi8(
+                                _mm_and_si128( _mm_srli_epi16( bytes , 4 ) , low ) ,
+                                _mm_and_si128( bytes , low )
+                            );
+    const __m128i letters = _mm_and_si128( _mm_cmpgt_epi8( nibbles , _mm_set1_epi8( 9 ) ) , _mm_set1_epi8( 'a' - '0' - 10 ) );
+    const __m128i zeros   = _mm_cmpeq_epi8( nibbles , _mm_setzero_si128() );
+
+    return write_trimmed(
+        first ,
+        _mm_add_epi8( _mm_add_epi8( nibbles , _mm_set1_epi8( '0' ) ) , letters ) ,
+        unsigned( _mm_movemask_epi8( zeros ) )
+    );
+}
+
+#endif
+
+template<typename T>
+inline char* format_integer( char* first , char* last , T val , int base )
+{
+    using unsigned_type = ::std::make_unsigned_t<T>;
+
+#ifdef TABLEPRINTER_SSE2
+    if ( last - first >= 32 && base != 8 )
+    {
+        if ( base == 16 )
+            return write_hex( first , unsigned_type( val ) );
+
+        bool negative {};
+        auto magnitude { unsigned_type( val ) };
+
+        if constexpr ( ::std::is_signed_v<T> )
+        {
+            negative = val < 0;
+
+            if ( negative )
+                magnitude = unsigned_type( 0 ) - magnitude;
+        }
+
+        if ( ::std::uint64_t( magnitude ) < 10000000000000000ull )
+        {
+            if ( negative )
+                *first++ = '-';
+
+            return write_decimal( first , magnitude );
+        }
+    }
+#endif
+
+    auto result = base == 10 ?
+                  ::std::to_chars( first , last , val ) :
+                  ::std::to_chars( first , last , unsigned_type( val ) , base );
+
+    return result.ec == ::std::errc {} ? result.ptr : nullptr;
+}
+
+// '__extension__' keeps '-Wpedantic' quiet about the non standard type.
+#ifdef __SIZEOF_INT128__
+__extension__ typedef unsigned __int128 wide_uint;
+#else
+using wide_uint = ::std::uint64_t;
+#endif
+
+// Formats 'val' with 'prec' digits after the decimal point exactly like
+// printf's '%.*f', rounding the exact binary value half to even. Works
+// on the mantissa as an integer, so it returns 'nullptr' if the scaled
+// value does not fit into 64 bits. Needs 64 bytes at 'first'.
+inline char* format_fixed( char* first , double val , int prec )
+{
+    constexpr ::std::uint64_t powers[] = {
+        1ull , 10ull , 100ull , 1000ull , 10000ull , 100000ull , 1000000ull ,
+        10000000ull , 100000000ull , 1000000000ull , 10000000000ull ,
+        100000000000ull , 1000000000000ull , 10000000000000ull ,
+        100000000000000ull , 1000000000000000ull , 10000000000000000ull ,
+        100000000000000000ull , 1000000000000000000ull ,
+        10000000000000000000ull
+    };
+
+    constexpr int wide_bits { int( sizeof( wide_uint ) * 8 ) };
+
+    if ( prec >= int( ::std::size( powers ) ) )
+        return nullptr;
+
+    ::std::uint64_t bits;
+    ::std::memcpy( &bits , &val , sizeof( bits ) );
+
+    const bool negative   { bool( bits >> 63 ) };
+    const int  biased     { int( ( bits >> 52 ) & 0x7ff ) };
+    wide_uint  mantissa   { bits & ( ( ::std::uint64_t { 1 } << 52 ) - 1 ) };
+    int        exponent   { -1074 };
+
+    if ( biased )
+    {
+        mantissa |= wide_uint { 1 } << 52;
+        exponent  = biased - 1075;
+    }
+
+    const auto pow { powers[ prec ] };
+
+    if ( mantissa > ~wide_uint {} / pow )
+        return nullptr;
+
+    wide_uint scaled { mantissa * pow };
+
+    if ( exponent >= 0 )
+    {
+        if ( exponent >= wide_bits || scaled > ( ~wide_uint {} >> exponent ) )
+            return nullptr;
+
+        scaled <<= exponent;
+    }
+    else if ( -exponent > wide_bits )
+    {
+        scaled = 0;
+    }
+    else if ( -exponent == wide_bits )
+    {
+        scaled = scaled > ( wide_uint { 1 } << ( wide_bits - 1 ) );
+    }
+    else
+    {
+        const int  shift { -exponent };
+        const auto rest  { scaled & ( ( wide_uint { 1 } << shift ) - 1 ) };
+        const auto half  { wide_uint { 1 } << ( shift - 1 ) };
+
+        scaled >>= shift;
+
+        if ( rest > half || ( rest == half && ( scaled & 1 ) ) )
+            ++scaled;
+    }
+
+    if ( scaled > ::std::numeric_limits<::std::uint64_t>::max() )
+        return nullptr;
+
+    const auto rounded { ::std::uint64_t( scaled ) };
+
+    if ( negative )
+        *first++ = '-';
+
+    first = format_integer( first , first + 32 , rounded / pow , 10 );
+
+    if ( prec )
+    {
+        auto fraction { rounded % pow };
+
+        *first++ = '.';
+
+        for ( int i = prec; i--; fraction /= 10 )
+            first[ i ] = char( '0' + fraction % 10 );
+
+        first += prec;
+    }
+
+    return first;
+}
+
+// Formats 'val' the way 'std::ostream' would do with the state of 'ios'
+// and the classic locale, but without padding. Returns 'nullptr' if the
+// state needs something that is not supported natively.
+template<typename T>
+inline char* format( char* first , char* last , T val , const ::std::ios_base& ios )
+{
+    using ios_base = ::std::ios_base;
+
+    static_assert( is_native_v<T> , "T must be an arithmetic type." );
+
+    const auto flags { ios.flags() };
+
+    if ( flags & ( ios_base::showbase | ios_base::showpos | ios_base::showpoint | ios_base::uppercase ) )
+        return nullptr;
+
+    if constexpr ( ::std::is_integral_v<T> )
+    {
+        const auto basefield { flags & ios_base::basefield };
+
+        int base { 10 };
+
+        if ( basefield == ios_base::hex )
+            base = 16;
+        else if ( basefield == ios_base::oct )
+            base = 8;
+
+        return format_integer( first , last , val , base );
+    }
+    else
+    {
+        const auto floatfield { flags & ios_base::floatfield };
+        const auto prec       { ios.precision() };
+
+        if ( !::std::isfinite( val ) || prec < 0 || prec > ::std::numeric_limits<int>::max() )
+            return nullptr;
+
+        if constexpr ( !::std::is_same_v<T , long double> )
+        {
+            if ( floatfield == ios_base::fixed && last - first >= 64 )
+            {
+                if ( auto end = format_fixed( first , double( val ) , int( prec ) ) )
+                    return end;
+            }
+        }
+
+#if defined( __cpp_lib_to_chars ) && __cpp_lib_to_chars >= 201611L
+        ::std::chars_format fmt;
+
+        if ( floatfield == ios_base::fixed )
+            fmt = ::std::chars_format::fixed;
+        else if ( floatfield == ios_base::scientific )
+            fmt = ::std::chars_format::scientific;
+        else if ( floatfield == ios_base::fmtflags {} )
+            fmt = ::std::chars_format::general;
+        else
+            return nullptr;
+
+        auto result = ::std::to_chars( first , last , val , fmt , int( prec ) );
+
+        return result.ec == ::std::errc {} ? result.ptr : nullptr;
+#else
+        return nullptr;
+#endif
+    }
+}
+
+class row_buffer : public ::std::streambuf
+{
+public:
+
+    row_buffer() = default;
+
+    explicit row_buffer( const allocator& alloc ) : m_data { alloc }
+    {}
+
+    ::std::string_view view() const noexcept
+    {
+        return m_data;
+    }
+
+    void clear() noexcept
+    {
+        m_data.clear();
+    }
+
+    void reserve( ::std::size_t capacity )
+    {
+        m_data.reserve( capacity );
+    }
+
+    void release( ::std::size_t capacity ) noexcept
+    {
+        if ( m_data.capacity() > capacity )
+            string { m_data.get_allocator() }.swap( m_data );
+    }
+
+    void append( ::std::string_view text , ::std::streamsize width , char fill , bool left )
+    {
+        const auto pad {
+            width > ::std::streamsize( size( text ) ) ?
+            ::std::size_t( width ) - size( text ) :
+            ::std::size_t {}
+        };
+
+        if ( !left )
+            m_data.append( pad , fill );
+
+        m_data.append( text );
+
+        if ( left )
+            m_data.append( pad , fill );
+    }
+
+protected:
+
+    int_type overflow( int_type ch ) override
+    {
+        if ( !traits_type::eq_int_type( ch , traits_type::eof() ) )
+            m_data.push_back( traits_type::to_char_type( ch ) );
+
+        return traits_type::not_eof( ch );
+    }
+
+    ::std::streamsize xsputn( const char* s , ::std::streamsize n ) override
+    {
+        m_data.append( s , static_cast<::std::size_t>( n ) );
+
+        return n;
+    }
+
+private:
+
+    string m_data;
+};
+
+class row_stream : public ::std::ostream
+{
+public:
+
+    row_stream() : row_stream { allocator {} }
+    {}
+
+    explicit row_stream( const allocator& alloc )
+        :   ::std::ostream { nullptr }
+        ,   m_buffer { alloc }
+    {
+        rdbuf( &m_buffer );
+
+        m_native = getloc() == ::std::locale::classic();
+    }
+
+    row_stream( const row_stream& other ) : row_stream {}
+    {
+        copyfmt( other );
+
+        m_native = other.m_native;
+    }
+
+    row_stream& operator=( const row_stream& other )
+    {
+        copyfmt( other );
+
+        m_native = other.m_native;
+
+        return *this;
+    }
+
+    ::std::locale imbue( const ::std::locale& loc )
+    {
+        auto previous { ::std::ostream::imbue( loc ) };
+
+        m_native = loc == ::std::locale::classic();
+
+        return previous;
+    }
+
+    template<typename T>
+    void insert( const T& val )
+    {
+        if constexpr ( is_native_v<T> )
+        {
+            const auto adjust { flags() & ::std::ios_base::adjustfield };
+
+            char  buf[ 512 ];
+            char* last {};
+
+            if ( m_native && adjust != ::std::ios_base::internal )
+                last = format( buf , buf + sizeof( buf ) , val , *this );
+
+            if ( last )
+            {
+                m_buffer.append(
+                    ::std::string_view ( buf , ::std::size_t( last - buf ) ) ,
+                    width() ,
+                    fill() ,
+                    adjust == ::std::ios_base::left
+                );
+
+                width( 0 );
+
+                return;
+            }
+        }
+        else if constexpr ( is_string_v<T> )
+        {
+            if constexpr ( ::std::is_pointer_v<T> )
+            {
+                if ( !val )
+                {
+                    fallback( val );
+
+                    return;
+                }
+            }
+
+            // Strings are neither affected by the locale nor by any flag but
+            // the adjustment, 'internal' pads on the left like 'right' does.
+            m_buffer.append(
+                ::std::string_view { val } ,
+                width() ,
+                fill() ,
+                ( flags() & ::std::ios_base::adjustfield ) == ::std::ios_base::left
+            );
+
+            width( 0 );
+
+            return;
+        }
+
+        fallback( val );
+    }
+
+    ::std::string_view view() const noexcept
+    {
+        return m_buffer.view();
+    }
+
+    // Whether a cell failed to insert since the buffer was last discarded.
+    bool failed() const noexcept
+    {
+        return m_failed || fail();
+    }
+
+    void reset() noexcept
+    {
+        ::std::ostream::clear();
+        flags( ::std::ios_base::skipws | ::std::ios_base::dec );
+        precision( 6 );
+        fill( ' ' );
+        width( 0 );
+    }
+
+    void discard() noexcept
+    {
+        ::std::ostream::clear();
+        m_buffer.clear();
+        m_failed = false;
+    }
+
+    void reserve( ::std::size_t capacity )
+    {
+        m_buffer.reserve( capacity );
+    }
+
+    // Frees the buffer if it grew beyond 'capacity'.
+    void release( ::std::size_t capacity ) noexcept
+    {
+        m_buffer.release( capacity );
+    }
+
+    bool native() const noexcept
+    {
+        return m_native;
+    }
+
+private:
+
+    // A cell that fails to insert is recorded and the state of the stream is
+    // cleared, so that the next cells and the line break are still rendered.
+    template<typename T>
+    void fallback( const T& val )
+    {
+        *this << val;
+
+        if ( fail() )
+        {
+            m_failed = true;
+
+            ::std::ostream::clear();
+            width( 0 );
+        }
+    }
+
+    row_buffer m_buffer;
+    bool m_native {};
+    bool m_failed {};
+};
+
+// Row buffer of the calling thread for the printers which render rows on
+// the caller's thread. It is shared by all of them, whatever they print, so
+// nothing is left in it between calls.
+inline row_stream& local_row()
+{
+    thread_local row_stream row;
+
+    return row;
+}
+
+// Bounded multi-producer/multi-consumer queue based on Dmitry Vyukov's
+// design. Slots are reused, 'push' and 'pop' hand out a reference to the
+// slot instead of moving values in and out of it.
+template<typename T>
+class bounded_queue
+{
+public:
+
+    explicit bounded_queue( ::std::size_t capacity )
+    {
+        ::std::size_t size { 2 };
+
+        while ( size < capacity )
+            size *= 2;
+
+        m_cells = ::std::make_unique<cell[]>( size );
+        m_mask  = size - 1;
+
+        for ( ::std::size_t i {}; i < size; ++i )
+            m_cells[ i ].sequence.store( i , ::std::memory_order_relaxed );
+    }
+
+    template<typename F>
+    bool push( F&& fill )
+    {
+        auto pos { m_enqueue_pos.load( ::std::memory_order_relaxed ) };
+
+        for ( ;; )
+        {
+            cell& c { m_cells[ pos & m_mask ] };
+
+            const auto seq  { c.sequence.load( ::std::memory_order_acquire ) };
+            const auto diff { ::std::intptr_t( seq ) - ::std::intptr_t( pos ) };
+
+            if ( diff == 0 )
+            {
+                if ( m_enqueue_pos.compare_exchange_weak( pos , pos + 1 , ::std::memory_order_relaxed ) )
+                {
+                    fill( c.value );
+                    c.sequence.store( pos + 1 , ::std::memory_order_release );
+
+                    return true;
+                }
+            }
+            else if ( diff < 0 )
+            {
+                return false;
+            }
+            else
+            {
+                pos = m_enqueue_pos.load( ::std::memory_order_relaxed );
+            }
+        }
+    }
+
+    // Whether the oldest value is published, so that 'pop' finds it. A slot
+    // that is claimed but still being filled is not.
+    bool ready() const noexcept
+    {
+        const auto pos { m_dequeue_pos.load( ::std::memory_order_relaxed ) };
+
+        return m_cells[ pos & m_mask ].sequence.load( ::std::memory_order_acquire ) == pos + 1;
+    }
+
+    template<typename F>
+    bool pop( F&& take )
+    {
+        auto pos { m_dequeue_pos.load( ::std::memory_order_relaxed ) };
+
+        for ( ;; )
+        {
+            cell& c { m_cells[ pos & m_mask ] };
+
+            const auto seq  { c.sequence.load( ::std::memory_order_acquire ) };
+            const auto diff { ::std::intptr_t( seq ) - ::std::intptr_t( pos + 1 ) };
+
+            if ( diff == 0 )
+            {
+                if ( m_dequeue_pos.compare_exchange_weak( pos , pos + 1 , ::std::memory_order_relaxed ) )
+                {
+                    take( c.value );
+                    c.sequence.store( pos + m_mask + 1 , ::std::memory_order_release );
+
+                    return true;
+                }
+            }
+            else if ( diff < 0 )
+            {
+                return false;
+            }
+            else
+            {
+                pos = m_dequeue_pos.load( ::std::memory_order_relaxed );
+            }
+        }
+    }
+
+private:
+
+    struct cell
+    {
+        ::std::atomic<::std::size_t> sequence;
+        T value;
+    };
+
+    ::std::unique_ptr<cell[]> m_cells;
+    ::std::size_t m_mask {};
+    alignas( 64 ) ::std::atomic<::std::size_t> m_enqueue_pos {};
+    alignas( 64 ) ::std::atomic<::std::size_t> m_dequeue_pos {};
+};
+
+template<typename T>
+inline void insert( ::std::ostream& os , const T& val )
+{
+    os << val;
+}
+
+template<typename T>
+inline void insert( row_stream& os , const T& val )
+{
+    os.insert( val );
+}
+
+inline ::std::size_t count_digits( ::std::uint64_t val ) noexcept
+{
+    ::std::size_t n { 1 };
+
+    for ( ;; )
+    {
+        if ( val < 10 )
+            return n;
+
+        if ( val < 100 )
+            return n + 1;
+
+        if ( val < 1000 )
+            return n + 2;
+
+        if ( val < 10000 )
+            return n + 3;
+
+        val /= 10000;
+        n += 4;
+    }
+}
+
+// Length of 'val' when it is inserted into a stream in 'state' with a zero
+// width. Decimal integers and strings are measured without formatting them,
+// anything else is formatted into 'scratch'.
+template<typename T>
+inline ::std::size_t measure( const T& val , const format_state& state , row_stream& scratch )
+{
+    if constexpr ( is_string_v<T> )
+    {
+        if constexpr ( ::std::is_pointer_v<T> )
+        {
+            if ( val )
+                return ::std::char_traits<char>::length( val );
+        }
+        else
+        {
+            return size( ::std::string_view { val } );
+        }
+    }
+    else if constexpr ( is_native_v<T> && ::std::is_integral_v<T> )
+    {
+        const auto base { state.flags & ::std::ios_base::basefield };
+
+        if ( scratch.native()                                          &&
+             ( base == ::std::ios_base::dec || base == ::std::ios_base::fmtflags {} ) &&
+             !( state.flags & ::std::ios_base::showpos ) )
+        {
+            if constexpr ( ::std::is_signed_v<T> )
+            {
+                if ( val < 0 )
+                    return 1 + count_digits( ::std::uint64_t( 0 ) - ::std::uint64_t( val ) );
+            }
+
+            return count_digits( ::std::uint64_t( val ) );
+        }
+    }
+
+    restore( state , scratch );
+    scratch.width( 0 );
+    scratch.discard();
+    scratch.insert( val );
+
+    return size( scratch.view() );
+}
+
+// An upper bound of 'measure'. Fixed and general floating point values are
+// bounded by their magnitude and precision instead of being formatted.
+template<typename T>
+inline ::std::size_t estimate( const T& val , const format_state& state , row_stream& scratch )
+{
+    if constexpr ( ::std::is_floating_point_v<T> )
+    {
+        const auto field { state.flags & ::std::ios_base::floatfield };
+        const auto precision { ::std::size_t( state.precision < 0 ? 6 : state.precision ) };
+
+        if ( scratch.native() && ::std::isfinite( val ) && precision < 1024 )
+        {
+            if ( field == ::std::ios_base::fixed )
+            {
+                // Sign, integral digits, a carry of the rounding and the point.
+                const auto magnitude { ::std::fabs( val ) };
+                const auto integral {
+                    magnitude < T( 1e19 ) ?
+                    count_digits( ::std::uint64_t( magnitude ) ) :
+                    ::std::size_t( ::std::numeric_limits<T>::max_exponent10 + 1 )
+                };
+
+                return 3 + integral + precision;
+            }
+
+            // Sign, leading digit, point, 'e', exponent sign and digits.
+            if ( field == ::std::ios_base::fmtflags {} || field == ::std::ios_base::scientific )
+                return 9 + precision;
+        }
+    }
+
+    return measure( val , state , scratch );
+}
+
+}
+
+struct printer_exception : ::std::logic_error
+{
+    using ::std::logic_error::logic_error;
+};
+
+struct arguments_size_doesnt_match_with_columns : printer_exception
+{
+    using printer_exception::printer_exception;
+};
+
+struct duplicate_option : printer_exception
+{
+    using printer_exception::printer_exception;
+};
+
+struct both_left_and_right_option : printer_exception
+{
+    using printer_exception::printer_exception;
+};
+
+struct both_precision_and_default_precision : printer_exception
+{
+    using printer_exception::printer_exception;
+};
+
+struct both_fixed_and_unfixed : printer_exception
+{
+    using printer_exception::printer_exception;
+};
+
+struct columns_length_mismatch : printer_exception
+{
+    using printer_exception::printer_exception;
+};
+
+struct queue_capacity
+{
+    explicit queue_capacity( ::std::size_t val ) : value { val }
+    {}
+
+    ::std::size_t value;
+
+    operator ::std::size_t() const noexcept { return value; }
+};
+
+enum class overflow_policy
+{
+    block ,
+    drop_newest ,
+    drop_oldest
+};
+
+template<typename Iter>
+inline auto sequence( Iter beg , Iter end )
+{
+    static_assert(
+        detail::is_input_iter_v<Iter> ,
+        "'Iter' should support ++,*,!="
+    );
+
+    return detail::sequence<Iter> { beg , end };
+}
+
+template<typename Container>
+inline auto sequence( Container&& c )
+{
+    static_assert(
+        detail::is_container_v<Container> ,
+        "'Container' should have 'begin()' and 'end()'"
+    );
+
+    using Iterator = decltype( ::std::begin( c ) );
+
+    return detail::sequence<Iterator> {
+        ::std::begin( c ) ,
+        ::std::end( c )
+    };
+}
+
+struct column
+{
+    column( ::std::initializer_list<option> opts ) : options { opts }
+    {}
+
+    detail::option_list options;
+};
+
+template<typename... Options>
+struct static_column
+{
+    template<typename Opt>
+    static constexpr ::std::size_t count { ( ::std::size_t { ::std::is_same_v<detail::static_option_t<Options> , Opt> } + ... + 0 ) };
+
+    static_assert( count<name> < 2 , "Multiple 'name' options are not sane." );
+    static_assert( count<width> < 2 , "Multiple 'width' options are not sane." );
+    static_assert( count<precision> < 2 , "Multiple 'precision' options are not sane." );
+    static_assert( count<fill> < 2 , "Multiple 'fill' options are not sane." );
+    static_assert( !count<left> || !count<right> , "Specifying both 'left' and 'right' options are not sane." );
+    static_assert( !count<precision> || !count<default_precision> , "Specifying both 'precision' and 'default_precision' options are not sane." );
+    static_assert( !count<fixed> || !count<unfixed> , "Specifying both 'fixed' and 'unfixed' options are not sane." );
+    static_assert( !count<auto_width> , "'auto_width' needs a 'printer', static columns have a constant width." );
+
+    static constexpr detail::column_plan plan { detail::compile<Options...>() };
+    static constexpr ::std::string_view  header { detail::static_names_of<Options...>() };
+};
+
+template<typename T>
+struct is_static_column : ::std::false_type
+{};
+
+template<typename... Options>
+struct is_static_column<static_column<Options...>> : ::std::true_type
+{};
+
+template<typename T>
+static constexpr bool is_static_column_v = is_static_column<T>::value;
+
+// A printer whose columns are known at compile time. The options of every
+// column are folded into a constant plan, the number of arguments is
+// checked by the compiler and each cell is formatted without any dispatch.
+// Rows are rendered once into an internal buffer like 'render_once'.
+template<typename... Columns>
+class static_printer
+{
+public:
+
+    static_assert(
+        ( is_static_column_v<Columns> && ... ) ,
+        "Columns should be 'static_column's."
+    );
+
+    using osref = detail::osref;
+
+    inline explicit static_printer( ::std::vector<osref> streams = ::std::vector<osref> {} );
+    inline explicit static_printer( ::std::ostream& stream );
+
+    template<typename... Ts>
+    inline static_printer& add_streams( ::std::ostream& os , Ts&... streams );
+
+    template<typename... Ts>
+    inline static_printer& remove_streams( ::std::ostream& os , Ts&... streams );
+
+    template<typename... Ts>
+    inline static_printer& print( const ::std::tuple<Ts...>& values );
+
+    template<typename... Ts>
+    inline static_printer& print( const Ts&... );
+    inline static_printer& echo( ::std::string_view );
+    inline static_printer& print_headers();
+    inline static_printer& flush();
+    inline const ::std::vector<osref>& streams() const noexcept;
+
+private:
+
+    template<typename Column , typename T>
+    inline void print_cell( const T& );
+
+    template<typename Column>
+    inline void print_header();
+
+    ::std::vector<osref> m_streams;
+    detail::row_stream m_row;
+};
+
+// Once a row has been printed, printing more rows of arithmetic values and
+// strings does not allocate, unless a row or a batch is longer than every
+// one before it or a stream allocates on its own.
+class printer
+{
+public:
+
+    using osref = detail::osref;
+    using allocator_type = detail::allocator;
+    using stream_list = detail::vector<osref>;
+
+    inline explicit printer(
+        ::std::vector<column> columns ,
+        ::std::vector<osref>  streams = ::std::vector<osref> {}
+    );
+
+    inline explicit printer(
+        ::std::vector<column> columns ,
+        ::std::ostream& stream
+    );
+
+    // Takes everything the printer holds from 'alloc', e.g. a
+    // 'std::pmr::memory_resource*' when TABLEPRINTER_USE_PMR is defined. Only
+    // columns with more than 'option_list::inline_capacity' options and
+    // names longer than the small string size still use the global heap.
+    inline printer(
+        const ::std::vector<column>& columns ,
+        ::std::initializer_list<osref> streams ,
+        const allocator_type& alloc
+    );
+
+    inline printer(
+        const ::std::vector<column>& columns ,
+        ::std::ostream& stream ,
+        const allocator_type& alloc
+    );
+
+    template<typename... Ts>
+    inline printer& add_streams( ::std::ostream& os , Ts&... streams );
+
+    template<typename... Ts>
+    inline printer& remove_streams( ::std::ostream& os , Ts&... streams );
+
+    template<typename... Ts>
+    inline printer& print( const ::std::tuple<Ts...>& values );
+
+    template<typename... Ts>
+    inline printer& print( const Ts&... );
+
+    // Prints a row per element of 'rows', either a tuple or what
+    // 'projections' make of it, one per column. With 'render_once' the rows
+    // are rendered into a batch written to every stream at once, otherwise
+    // they are printed one by one like 'print' does, following the state of
+    // each stream.
+    template<typename Range , typename... Projections>
+    inline printer& print_rows( const Range& rows , const Projections&... projections );
+
+    // Prints the rows of parallel 'columns', the n-th row being made of the
+    // n-th value of each one. With 'render_once' the values are formatted
+    // column by column into blocks of rows written to every stream at once,
+    // otherwise they are printed row by row like 'print' does, following the
+    // state of each stream.
+    template<typename... Columns>
+    inline printer& print_columns( const Columns&... columns );
+
+    template<typename Range , typename... Projections>
+    inline printer& print_table( const Range& rows , const Projections&... projections );
+
+    inline printer& echo( ::std::string_view );
+    inline printer& print_headers();
+    inline const printer& sanity_check() const;
+    inline printer& sanity_check();
+    inline printer& flush();
+    inline printer& render_once( bool enabled = true ) noexcept;
+
+    // 'stream_list' is a 'std::vector<osref>' unless TABLEPRINTER_USE_PMR
+    // is defined, in which case it is a 'std::pmr::vector<osref>' drawn from
+    // the printer's memory resource.
+    inline const stream_list& streams() const noexcept;
+
+private:
+
+    friend class concurrent_printer;
+    friend class async_printer;
+
+    static constexpr ::std::size_t batch_size { 1 << 16 };
+    static constexpr ::std::size_t block_rows { 1 << 10 };
+
+    inline void compile_columns();
+
+    template<typename... Ts>
+    inline void render( detail::row_stream& , const Ts&... );
+
+    template<typename... Ts>
+    inline void append( detail::row_stream& , const Ts&... );
+
+    template<::std::size_t N>
+    inline void plan_states(
+        ::std::array<detail::format_state , N>& firsts ,
+        ::std::array<detail::format_state , N>& rests
+    );
+
+    template<::std::size_t N , typename... Ts>
+    inline ::std::size_t measure_row(
+        const ::std::array<detail::format_state , N>& states ,
+        ::std::array<::std::size_t , N>& longest ,
+        const Ts&...
+    );
+
+    template<typename Column>
+    inline void format_column(
+        int col ,
+        const Column& ,
+        ::std::size_t begin ,
+        ::std::size_t end ,
+        const detail::format_state& first ,
+        const detail::format_state& rest
+    );
+
+    inline void render_headers( ::std::ostream& , detail::running_width* own = nullptr );
+    inline void add_stream_widths( ::std::size_t streams );
+    inline detail::running_width* stream_widths( ::std::size_t stream ) noexcept;
+
+    inline void write( ::std::string_view ) const;
+    inline void write( const detail::row_stream& ) const;
+
+    template<typename Stream , typename H , typename... T>
+    inline void print_column( int col , Stream& , const H& , const T&... );
+
+    template<typename T>
+    inline void insert_fitted( int col , detail::row_stream& , const T& );
+
+    template<typename T>
+    inline void insert_fitted( int col , ::std::ostream& , const T& );
+
+    inline void follow_locale( const ::std::ostream& );
+
+    template<typename... Ts , ::std::size_t... Idx>
+    inline void print_tuple( const ::std::tuple<Ts...>& , ::std::index_sequence<Idx...> );
+
+    inline void throw_if_arguments_size_mismatch( ::std::size_t count ) const;
+
+    template<typename T>
+    inline void throw_if_duplicate_opt( const column& , const detail::option_counts& , ::std::string_view error ) const;
+
+    inline void throw_if_both_left_and_right_opt( const detail::option_counts& ) const;
+    inline void throw_if_both_precision_and_default_precision_opt( const detail::option_counts& ) const;
+    inline void throw_if_both_fixed_and_unfixed_opt( const detail::option_counts& ) const;
+
+    stream_list m_streams;
+    detail::vector<column> m_columns;
+    detail::vector<detail::column_plan> m_plans;
+    detail::vector<detail::running_width> m_widths;
+    detail::vector<detail::running_width> m_stream_widths;
+    detail::row_stream m_row;
+    detail::row_stream m_cell;
+    detail::row_stream m_scratch;
+    detail::string m_batch;
+    detail::vector<::std::size_t> m_offsets;
+    ::std::size_t m_stream {};
+    bool m_render_once {};
+    bool m_auto_width {};
+};
+
+// Formats each row into a buffer owned by the calling thread and writes
+// the whole row to the streams under a lock, so rows printed from
+// different threads never interleave. Every row starts from the default
+// stream state, options do not leak from one row to the next.
+class concurrent_printer
+{
+public:
+
+    using osref = printer::osref;
+
+    inline explicit concurrent_printer(
+        ::std::vector<column> columns ,
+        ::std::vector<osref>  streams = ::std::vector<osref> {}
+    );
+
+    inline explicit concurrent_printer(
+        ::std::vector<column> columns ,
+        ::std::ostream& stream
+    );
+
+    template<typename... Ts>
+    inline concurrent_printer& add_streams( ::std::ostream& os , Ts&... streams );
+
+    template<typename... Ts>
+    inline concurrent_printer& remove_streams( ::std::ostream& os , Ts&... streams );
+
+    template<typename... Ts>
+    inline concurrent_printer& print( const ::std::tuple<Ts...>& values );
+
+    template<typename... Ts>
+    inline concurrent_printer& print( const Ts&... );
+    inline concurrent_printer& echo( ::std::string_view );
+    inline concurrent_printer& print_headers();
+    inline const concurrent_printer& sanity_check() const;
+    inline concurrent_printer& sanity_check();
+    inline concurrent_printer& flush();
+    inline ::std::vector<osref> streams() const;
+
+private:
+
+    printer m_printer;
+    mutable ::std::mutex m_mutex;
+};
+
+// Formats rows on the calling thread, like 'concurrent_printer', and hands
+// them to a dedicated writer thread through a bounded lock-free queue, so
+// slow streams never block 'print'. When the queue is full the row is
+// handled according to the 'overflow_policy'. 'flush' waits until every
+// queued row is written and rethrows the first exception a stream threw
+// on the writer thread since the last call.
+class async_printer
+{
+public:
+
+    using osref = printer::osref;
+
+    inline explicit async_printer(
+        ::std::vector<column> columns ,
+        ::std::vector<osref>  streams  = ::std::vector<osref> {} ,
+        queue_capacity        capacity = queue_capacity { 1024 } ,
+        overflow_policy       policy   = overflow_policy::block
+    );
+
+    inline explicit async_printer(
+        ::std::vector<column> columns ,
+        ::std::ostream& stream ,
+        queue_capacity  capacity = queue_capacity { 1024 } ,
+        overflow_policy policy   = overflow_policy::block
+    );
+
+    async_printer( const async_printer& ) = delete;
+    async_printer& operator=( const async_printer& ) = delete;
+
+    inline ~async_printer();
+
+    template<typename... Ts>
+    inline async_printer& add_streams( ::std::ostream& os , Ts&... streams );
+
+    template<typename... Ts>
+    inline async_printer& remove_streams( ::std::ostream& os , Ts&... streams );
+
+    template<typename... Ts>
+    inline async_printer& print( const ::std::tuple<Ts...>& values );
+
+    template<typename... Ts>
+    inline async_printer& print( const Ts&... );
+    inline async_printer& echo( ::std::string_view );
+    inline async_printer& print_headers();
+    inline const async_printer& sanity_check() const;
+    inline async_printer& sanity_check();
+    inline async_printer& flush();
+    inline ::std::size_t dropped() const noexcept;
+    inline ::std::vector<osref> streams() const;
+
+private:
+
+    inline void enqueue( ::std::string_view row );
+    inline void drain();
+    inline void write_rows();
+
+    printer m_printer;
+    overflow_policy m_policy;
+    detail::bounded_queue<::std::string> m_queue;
+    ::std::atomic<::std::size_t> m_pending {};
+    ::std::atomic<::std::size_t> m_dropped {};
+    ::std::atomic<::std::size_t> m_blocked {};
+    ::std::atomic<bool> m_idle {};
+    bool m_stop {};
+    mutable ::std::mutex m_streams_mutex;
+    ::std::mutex m_mutex;
+    ::std::condition_variable m_wakeup;
+    ::std::condition_variable m_drained;
+    ::std::condition_variable m_space;
+    ::std::exception_ptr m_error;
+    ::std::thread m_writer;
+};
+
+}
+
+tableprinter::printer::printer( ::std::vector<column> columns , ::std::vector<osref> streams )
+    :   m_streams { detail::adopt( move( streams ) ) }
+    ,   m_columns { detail::adopt( move( columns ) ) }
+{
+    compile_columns();
+}
+
+tableprinter::printer::printer( ::std::vector<column> columns , ::std::ostream& stream )
     :   printer
         {
             move( columns ) ,
-            ::std::vector<osref>{ stream }
+            ::std::vector<osref>{ stream }
+        }
+{   }
+
+tableprinter::printer::printer(
+    const ::std::vector<column>& columns ,
+    ::std::initializer_list<osref> streams ,
+    const allocator_type& alloc
+)
+    :   m_streams { streams , alloc }
+    ,   m_columns { begin( columns ) , end( columns ) , alloc }
+    ,   m_plans { alloc }
+    ,   m_widths { alloc }
+    ,   m_stream_widths { alloc }
+    ,   m_row { alloc }
+    ,   m_cell { alloc }
+    ,   m_scratch { alloc }
+    ,   m_batch { alloc }
+    ,   m_offsets { alloc }
+{
+    compile_columns();
+}
+
+tableprinter::printer::printer(
+    const ::std::vector<column>& columns ,
+    ::std::ostream& stream ,
+    const allocator_type& alloc
+)
+    :   printer { columns , { stream } , alloc }
+{   }
+
+template<typename... Ts>
+tableprinter::printer& tableprinter::printer::add_streams( std::ostream& os , Ts&... streams )
+{
+    detail::add_streams( m_streams , os , streams... );
+    add_stream_widths( 1 + sizeof...( Ts ) );
+
+    return *this;
+}
+
+template<typename... Ts>
+tableprinter::printer& tableprinter::printer::remove_streams( ::std::ostream& os , Ts&... streams )
+{
+    static_assert(
+        (::std::is_convertible_v<Ts& , ::std::ostream&> && ...) ,
+        "Ts should be inherited from 'std::ostream'"
+    );
+
+    // The widths of each stream are moved along with it.
+    const auto columns { size( m_columns ) };
+
+    ::std::size_t kept {};
+
+    for ( ::std::size_t idx {}; idx < size( m_streams ); ++idx )
+    {
+        const ::std::ostream* stream { &m_streams[ idx ].get() };
+
+        if ( &os == stream || ( ( ::std::addressof( streams ) == stream ) || ... ) )
+            continue;
+
+        m_streams[ kept ] = m_streams[ idx ];
+        ::std::copy_n( stream_widths( idx ) , columns , stream_widths( kept ) );
+        ++kept;
+    }
+
+    m_streams.erase( begin( m_streams ) + ::std::ptrdiff_t( kept ) , end( m_streams ) );
+    m_stream_widths.erase( begin( m_stream_widths ) + ::std::ptrdiff_t( kept * columns ) , end( m_stream_widths ) );
+
+    return *this;
+}
+
+template<typename... Ts>
+tableprinter::printer& tableprinter::printer::print( const Ts&... params )
+{
+    static_assert( sizeof...( Ts ) , "There must be arguments to print." );
+
+    if ( m_render_once )
+    {
+        if ( empty( m_streams ) )
+            return *this;
+
+        render( m_row , params... );
+        write( m_row );
+
+        return *this;
+    }
+
+    for ( m_stream = 0; m_stream < size( m_streams ); ++m_stream )
+    {
+        ::std::ostream& stream { m_streams[ m_stream ].get() };
+
+        if ( m_auto_width )
+            follow_locale( stream );
+
+        print_column( 0 , stream , params... );
+
+        stream << '\n';
+    }
+
+    return *this;
+}
+
+template<typename Range , typename... Projections>
+tableprinter::printer& tableprinter::printer::print_rows( const Range& rows , const Projections&... projections )
+{
+    static_assert(
+        detail::is_container_v<const Range&> ,
+        "'Range' should have 'begin()' and 'end()'"
+    );
+
+    using row_type = ::std::decay_t<decltype( *::std::begin( rows ) )>;
+
+    if constexpr ( bool( sizeof...( Projections ) ) )
+        throw_if_arguments_size_mismatch( sizeof...( Projections ) );
+    else
+        throw_if_arguments_size_mismatch( ::std::tuple_size_v<row_type> );
+
+    if ( !m_render_once )
+    {
+        for ( const auto& row : rows )
+            detail::apply_row(
+                [ this ]( const auto&... values )
+                {
+                    print( values... );
+                } ,
+                row ,
+                projections...
+            );
+
+        return *this;
+    }
+
+    if ( empty( m_streams ) )
+        return *this;
+
+    m_row.discard();
+
+    for ( const auto& row : rows )
+    {
+        detail::apply_row(
+            [ this ]( const auto&... values )
+            {
+                append( m_row , values... );
+            } ,
+            row ,
+            projections...
+        );
+
+        if ( size( m_row.view() ) >= batch_size )
+        {
+            write( m_row );
+            m_row.discard();
+        }
+    }
+
+    if ( !empty( m_row.view() ) )
+        write( m_row );
+
+    return *this;
+}
+
+template<typename... Columns>
+tableprinter::printer& tableprinter::printer::print_columns( const Columns&... columns )
+{
+    static_assert( sizeof...( Columns ) , "There must be columns to print." );
+
+    static_assert(
+        ( detail::is_contiguous_v<const Columns&> && ... ) ,
+        "'Columns' should have 'data()' and 'size()'"
+    );
+
+    throw_if_arguments_size_mismatch( sizeof...( Columns ) );
+
+    const ::std::size_t rows { ::std::size( ::std::get<0>( ::std::tie( columns... ) ) ) };
+
+    if ( ( ( ::std::size( columns ) != rows ) || ... ) )
+        throw columns_length_mismatch {
+            "All columns should have " +
+            ::std::to_string( rows ) +
+            " values."
+        };
+
+    if ( !m_render_once )
+    {
+        for ( ::std::size_t row {}; row < rows; ++row )
+            print( ::std::data( columns )[ row ]... );
+
+        return *this;
+    }
+
+    if ( empty( m_streams ) || !rows )
+        return *this;
+
+    constexpr auto count { sizeof...( Columns ) };
+
+    ::std::array<detail::format_state , count> firsts;
+    ::std::array<detail::format_state , count> rests;
+
+    plan_states( firsts , rests );
+
+    m_batch.clear();
+
+    bool failed {};
+
+    for ( ::std::size_t begin {}; begin < rows; begin += block_rows )
+    {
+        const auto end { ::std::min( begin + block_rows , rows ) };
+
+        m_row.discard();
+        m_offsets.clear();
+
+        ::std::size_t col {};
+
+        ( ( format_column( int( col ) , columns , begin , end , firsts[ col ] , rests[ col ] ) , ++col ) , ... );
+
+        const auto cells { m_row.view() };
+        const auto stride { end - begin + 1 };
+
+        failed = failed || m_row.failed();
+
+        for ( ::std::size_t row {}; row < end - begin; ++row )
+        {
+            for ( ::std::size_t col {}; col < count; ++col )
+            {
+                const auto* offset { &m_offsets[ col * stride + row ] };
+
+                m_batch.append( cells.substr( offset[ 0 ] , offset[ 1 ] - offset[ 0 ] ) );
+            }
+
+            m_batch.push_back( '\n' );
+        }
+
+        if ( size( m_batch ) >= batch_size )
+        {
+            write( m_batch );
+            m_batch.clear();
+        }
+    }
+
+    if ( !empty( m_batch ) )
+        write( m_batch );
+
+    if ( failed )
+        detail::fail( m_streams );
+
+    detail::restore( rows > 1 ? rests.back() : firsts.back() , m_row );
+    m_row.width( 0 );
+
+    return *this;
+}
+
+template<typename Range , typename... Projections>
+tableprinter::printer& tableprinter::printer::print_table( const Range& rows , const Projections&... projections )
+{
+    static_assert(
+        detail::is_container_v<const Range&> ,
+        "'Range' should have 'begin()' and 'end()'"
+    );
+
+    using row_type = ::std::decay_t<decltype( *::std::begin( rows ) )>;
+
+    constexpr ::std::size_t count {
+        []
+        {
+            if constexpr ( bool( sizeof...( Projections ) ) )
+                return sizeof...( Projections );
+            else
+                return ::std::tuple_size_v<row_type>;
+        }()
+    };
+
+    throw_if_arguments_size_mismatch( count );
+
+    ::std::array<detail::format_state , count> firsts;
+    ::std::array<detail::format_state , count> rests;
+
+    plan_states( firsts , rests );
+
+    // The first pass finds the longest cell of every 'auto_width' column and
+    // bounds the length of the table, the second one renders it in place.
+    ::std::array<::std::size_t , count> longest {};
+
+    for ( ::std::size_t col {}; col < count; ++col )
+        longest[ col ] = ::std::size_t( m_widths[ col ].get() );
+
+    ::std::size_t length {};
+    ::std::size_t lines {};
+
+    for ( const auto& row : rows )
+    {
+        detail::apply_row(
+            [ & ]( const auto&... values )
+            {
+                length += measure_row( lines ? rests : firsts , longest , values... );
+            } ,
+            row ,
+            projections...
+        );
+
+        ++lines;
+    }
+
+    for ( ::std::size_t col {}; col < count; ++col )
+    {
+        if ( !m_plans[ col ].auto_width )
+            continue;
+
+        m_widths[ col ].fit( longest[ col ] );
+        length += lines * ::std::size_t( m_widths[ col ].get() );
+    }
+
+    if ( empty( m_streams ) )
+        return *this;
+
+    m_row.discard();
+    m_row.reserve( length );
+
+    for ( const auto& row : rows )
+        detail::apply_row(
+            [ this ]( const auto&... values )
+            {
+                append( m_row , values... );
+            } ,
+            row ,
+            projections...
+        );
+
+    write( m_row );
+
+    m_row.discard();
+    m_row.release( batch_size );
+
+    return *this;
+}
+
+template<typename... Ts>
+tableprinter::printer& tableprinter::printer::print( const ::std::tuple<Ts...>& values )
+{
+    throw_if_arguments_size_mismatch( sizeof...( Ts ) );
+
+    print_tuple( values , ::std::make_index_sequence<sizeof...( Ts )>() );
+
+    return *this;
+}
+
+tableprinter::printer& tableprinter::printer::echo( ::std::string_view str )
+{
+    for ( ::std::ostream& stream : m_streams )
+        stream << str << "\n";
+
+    return *this;
+}
+
+tableprinter::printer& tableprinter::printer::print_headers()
+{
+    for ( ::std::size_t idx {}; idx < size( m_streams ); ++idx )
+        render_headers( m_streams[ idx ] , m_render_once ? nullptr : stream_widths( idx ) );
+
+    return *this;
+}
+
+const tableprinter::printer& tableprinter::printer::sanity_check() const
+{
+    for ( const column& column : m_columns )
+    {
+        const detail::option_counts counts { column.options };
+
+        throw_if_duplicate_opt<name>( column , counts , "Multiple 'name' options are not sane." );
+        throw_if_duplicate_opt<width>( column , counts , "Multiple 'width' options are not sane.");
+        throw_if_duplicate_opt<precision>( column , counts , "Multiple 'precision' options are not sane." );
+        throw_if_duplicate_opt<fill>( column , counts , "Multiple 'fill' options are not sane." );
+        throw_if_both_left_and_right_opt( counts );
+        throw_if_both_precision_and_default_precision_opt( counts );
+        throw_if_both_fixed_and_unfixed_opt( counts );
+    }
+
+    return *this;
+}
+
+tableprinter::printer& tableprinter::printer::sanity_check()
+{
+    const auto& self { *this };
+
+    self.sanity_check();
+
+    return *this;
+}
+
+tableprinter::printer& tableprinter::printer::flush()
+{
+    for ( ::std::ostream& os : m_streams )
+        os.flush();
+
+    return *this;
+}
+
+tableprinter::printer& tableprinter::printer::render_once( bool enabled ) noexcept
+{
+    m_render_once = enabled;
+
+    return *this;
+}
+
+const tableprinter::printer::stream_list&
+tableprinter::printer::streams() const noexcept
+{
+    return m_streams;
+}
+
+void tableprinter::printer::compile_columns()
+{
+    m_plans.reserve( size( m_columns ) );
+    m_widths.reserve( size( m_columns ) );
+
+    for ( const column& col : m_columns )
+    {
+        m_plans.push_back( detail::compile( col.options ) );
+        m_widths.emplace_back( m_plans.back().width );
+
+        m_auto_width = m_auto_width || m_plans.back().auto_width;
+    }
+
+    add_stream_widths( size( m_streams ) );
+}
+
+void tableprinter::printer::add_stream_widths( ::std::size_t streams )
+{
+    for ( ::std::size_t stream {}; stream < streams; ++stream )
+        m_stream_widths.insert( end( m_stream_widths ) , begin( m_widths ) , end( m_widths ) );
+}
+
+tableprinter::detail::running_width* tableprinter::printer::stream_widths( ::std::size_t stream ) noexcept
+{
+    return data( m_stream_widths ) + stream * size( m_columns );
+}
+
+template<typename... Ts>
+void tableprinter::printer::render( detail::row_stream& row , const Ts&... params )
+{
+    row.discard();
+
+    append( row , params... );
+}
+
+template<typename... Ts>
+void tableprinter::printer::append( detail::row_stream& row , const Ts&... params )
+{
+    print_column( 0 , row , params... );
+
+    row << '\n';
+}
+
+void tableprinter::printer::render_headers( ::std::ostream& stream , detail::running_width* own )
+{
+    for ( ::std::size_t idx {}; idx < size( m_columns ); ++idx )
+    {
+        const auto& col { m_columns[ idx ] };
+
+        detail::run(
+            detail::overloaded {
+                [ &stream ]( const width& w )
+                {
+                    stream << ::std::setw( w );
+                } ,
+                [ &stream]( const left& )
+                {
+                    stream << ::std::left;
+                } ,
+                [ &stream ]( const right& )
+                {
+                    stream << ::std::right;
+                }
+            } ,
+            col.options
+        );
+
+        if ( m_plans[ idx ].auto_width )
+        {
+            auto& w { own ? own[ idx ] : m_widths[ idx ] };
+
+            detail::run(
+                [ &w ]( const name& n )
+                {
+                    w.fit( size( n.value ) );
+                } ,
+                col.options
+            );
+
+            stream.width( ::std::max( w.get() , m_widths[ idx ].get() ) );
+        }
+
+        bool printed {};
+
+        detail::run(
+            [ &stream , &printed ]( const name& n )
+            {
+                printed = true;
+                stream << n.value;
+            } ,
+            col.options
+        );
+
+        if ( !printed )
+            stream << "";
+    }
+
+    stream << '\n';
+}
+
+void tableprinter::printer::write( ::std::string_view row ) const
+{
+    detail::write( m_streams , row );
+}
+
+void tableprinter::printer::write( const detail::row_stream& row ) const
+{
+    detail::write( m_streams , row.view() );
+
+    if ( row.failed() )
+        detail::fail( m_streams );
+}
+
+// Inserting a value only resets the width of a stream, so the state a cell
+// is formatted with depends on the plans only. It is the same for every row
+// except the first one, which still sees the state left by the previous row.
+template<::std::size_t N>
+void tableprinter::printer::plan_states(
+    ::std::array<detail::format_state , N>& firsts ,
+    ::std::array<detail::format_state , N>& rests
+)
+{
+    const auto origin { detail::capture( m_row ) };
+
+    for ( auto* states : { &firsts , &rests } )
+    {
+        for ( ::std::size_t col {}; col < N; ++col )
+        {
+            detail::apply( m_plans[ col ] , m_row );
+            ( *states )[ col ] = detail::capture( m_row );
+            m_row.width( 0 );
+        }
+    }
+
+    detail::restore( origin , m_row );
+}
+
+// Returns an upper bound of the length of a row, leaving out the cells of
+// 'auto_width' columns whose exact lengths are recorded in 'longest'.
+template<::std::size_t N , typename... Ts>
+::std::size_t tableprinter::printer::measure_row(
+    const ::std::array<detail::format_state , N>& states ,
+    ::std::array<::std::size_t , N>& longest ,
+    const Ts&... values
+)
+{
+    ::std::size_t length { 1 };
+    ::std::size_t col {};
+
+    (
+        [ & ]( const auto& val )
+        {
+            if ( m_plans[ col ].auto_width )
+            {
+                const auto cell { detail::measure( val , states[ col ] , m_scratch ) };
+
+                longest[ col ] = ::std::max( longest[ col ] , cell );
+            }
+            else
+            {
+                const auto cell { detail::estimate( val , states[ col ] , m_scratch ) };
+                const auto width { ::std::size_t( ::std::max<::std::streamsize>( states[ col ].width , 0 ) ) };
+
+                length += ::std::max( cell , width );
+            }
+
+            ++col;
+        }( values ) ,
+        ...
+    );
+
+    return length;
+}
+
+template<typename Column>
+void tableprinter::printer::format_column(
+    int col ,
+    const Column& column ,
+    ::std::size_t begin ,
+    ::std::size_t end ,
+    const detail::format_state& first ,
+    const detail::format_state& rest
+)
+{
+    const auto* values { ::std::data( column ) };
+
+    m_offsets.push_back( size( m_row.view() ) );
+
+    const bool fitted { m_plans[ col ].auto_width };
+
+    if ( !begin )
+    {
+        detail::restore( first , m_row );
+
+        if ( fitted )
+            insert_fitted( col , m_row , values[ begin++ ] );
+        else
+            m_row.insert( values[ begin++ ] );
+
+        m_offsets.push_back( size( m_row.view() ) );
+    }
+
+    detail::restore( rest , m_row );
+
+    if ( fitted )
+    {
+        for ( auto row { begin }; row < end; ++row )
+        {
+            insert_fitted( col , m_row , values[ row ] );
+            m_offsets.push_back( size( m_row.view() ) );
+        }
+
+        return;
+    }
+
+    for ( auto row { begin }; row < end; ++row )
+    {
+        m_row.width( rest.width );
+        m_row.insert( values[ row ] );
+        m_offsets.push_back( size( m_row.view() ) );
+    }
+}
+
+template<typename Stream , typename H , typename... T>
+void tableprinter::printer::print_column( int col , Stream& os , const H& val , const T&... rest )
+{
+    if constexpr ( detail::is_sequence_v<H> )
+    {
+        for ( auto itr = val.beg; !( itr == val.end ); ++itr , ++col )
+            print_column( col , os , *itr );
+    }
+    else
+    {
+        detail::apply( m_plans[ col ] , os );
+
+        if ( m_plans[ col ].auto_width )
+            insert_fitted( col , os , val );
+        else
+            detail::insert( os , val );
+
+        ++col;
+    }
+
+    if constexpr ( bool( sizeof...( rest ) ) )
+        print_column( col , os , rest... );
+}
+
+template<typename T>
+void tableprinter::printer::insert_fitted( int col , detail::row_stream& row , const T& val )
+{
+    const auto offset { size( row.view() ) };
+
+    row.width( m_widths[ col ].get() );
+    row.insert( val );
+
+    m_widths[ col ].fit( size( row.view() ) - offset );
+}
+
+template<typename T>
+void tableprinter::printer::insert_fitted( int col , ::std::ostream& os , const T& val )
+{
+    // The length of a cell written to a stream is not observable, so it is
+    // formatted with the state of the stream first and written as is. Each
+    // stream keeps its own widths, which follow its locale, on top of the
+    // ones of the rows rendered once for every stream.
+    auto& own { stream_widths( m_stream )[ col ] };
+
+    m_cell.discard();
+    m_cell.flags( os.flags() );
+    m_cell.precision( os.precision() );
+    m_cell.fill( os.fill() );
+    m_cell.width( ::std::max( own.get() , m_widths[ col ].get() ) );
+
+    m_cell.insert( val );
+
+    const auto text { m_cell.view() };
+
+    own.fit( size( text ) );
+
+    os.write( data( text ) , ::std::streamsize( size( text ) ) );
+    os.width( 0 );
+
+    if ( m_cell.failed() )
+        os.setstate( ::std::ios_base::failbit );
+}
+
+// Cells of 'auto_width' columns are formatted in 'm_cell' before being
+// written to a stream, so it takes the locale of the stream once per row
+// rather than once per cell, and only when it differs.
+void tableprinter::printer::follow_locale( const ::std::ostream& os )
+{
+    auto loc { os.getloc() };
+
+    if ( loc != m_cell.getloc() )
+        m_cell.imbue( loc );
+}
+
+template<typename... Ts , ::std::size_t... Idx>
+void tableprinter::printer::print_tuple( const ::std::tuple<Ts...>& values , ::std::index_sequence<Idx...> )
+{
+    print( ::std::get<Idx>( values )... );
+}
+
+void tableprinter::printer::throw_if_arguments_size_mismatch( ::std::size_t count ) const
+{
+    if ( count != size( m_columns ) )
+        throw arguments_size_doesnt_match_with_columns {
+            "There are " +
+            ::std::to_string( size( m_columns ) ) +
+            " columns but given " +
+            ::std::to_string( count ) +
+            " arguments."
+        };
+}
+
+template<typename T>
+void tableprinter::printer::throw_if_duplicate_opt( const column& col , const detail::option_counts& counts , ::std::string_view error ) const
+{
+    if ( counts.of<T>() > 1 )
+    {
+        throw duplicate_option {
+            ::std::string { error } +
+            " " +
+            detail::concat( detail::filter_opts<T>( col.options ) )
+        };
+    }
+}
+
+void tableprinter::printer::throw_if_both_left_and_right_opt( const detail::option_counts& counts ) const
+{
+    if ( counts.of<left>() && counts.of<right>() )
+    {
+        throw both_left_and_right_option {
+            "Specifying both 'left' and 'right' options are not sane."
+        };
+    }
+}
+
+void tableprinter::printer::throw_if_both_precision_and_default_precision_opt( const detail::option_counts& counts ) const
+{
+    if ( counts.of<precision>() && counts.of<default_precision>() )
+    {
+        throw both_precision_and_default_precision {
+            "Specifying both 'precision' and 'default_precision' options are not sane."
+        };
+    }
+}
+
+void tableprinter::printer::throw_if_both_fixed_and_unfixed_opt( const detail::option_counts& counts ) const
+{
+    if ( counts.of<fixed>() && counts.of<unfixed>() )
+    {
+        throw both_fixed_and_unfixed {
+            "Specifying both 'fixed' and 'unfixed' options are not sane."
+        };
+    }
+}
+
+template<typename... Columns>
+tableprinter::static_printer<Columns...>::static_printer( ::std::vector<osref> streams )
+    :   m_streams { move( streams ) }
+{   }
+
+template<typename... Columns>
+tableprinter::static_printer<Columns...>::static_printer( ::std::ostream& stream )
+    :   static_printer { ::std::vector<osref>{ stream } }
+{   }
+
+template<typename... Columns>
+template<typename... Ts>
+tableprinter::static_printer<Columns...>&
+tableprinter::static_printer<Columns...>::add_streams( ::std::ostream& os , Ts&... streams )
+{
+    detail::add_streams( m_streams , os , streams... );
+
+    return *this;
+}
+
+template<typename... Columns>
+template<typename... Ts>
+tableprinter::static_printer<Columns...>&
+tableprinter::static_printer<Columns...>::remove_streams( ::std::ostream& os , Ts&... streams )
+{
+    detail::remove_streams( m_streams , os , streams... );
+
+    return *this;
+}
+
+template<typename... Columns>
+template<typename... Ts>
+tableprinter::static_printer<Columns...>&
+tableprinter::static_printer<Columns...>::print( const Ts&... params )
+{
+    static_assert(
+        sizeof...( Ts ) == sizeof...( Columns ) ,
+        "The number of arguments should match the number of columns."
+    );
+
+    static_assert(
+        ( !detail::is_sequence_v<Ts> && ... ) ,
+        "A static_printer cannot print sequences."
+    );
+
+    if ( empty( m_streams ) )
+        return *this;
+
+    m_row.discard();
+
+    ( print_cell<Columns>( params ) , ... );
+
+    m_row << '\n';
+
+    detail::write( m_streams , m_row.view() );
+
+    if ( m_row.failed() )
+        detail::fail( m_streams );
+
+    return *this;
+}
+
+template<typename... Columns>
+template<typename... Ts>
+tableprinter::static_printer<Columns...>&
+tableprinter::static_printer<Columns...>::print( const ::std::tuple<Ts...>& values )
+{
+    ::std::apply(
+        [ this ]( const Ts&... params )
+        {
+            print( params... );
+        } ,
+        values
+    );
+
+    return *this;
+}
+
+template<typename... Columns>
+tableprinter::static_printer<Columns...>&
+tableprinter::static_printer<Columns...>::echo( ::std::string_view str )
+{
+    for ( ::std::ostream& stream : m_streams )
+        stream << str << "\n";
+
+    return *this;
+}
+
+template<typename... Columns>
+tableprinter::static_printer<Columns...>&
+tableprinter::static_printer<Columns...>::print_headers()
+{
+    m_row.discard();
+
+    ( print_header<Columns>() , ... );
+
+    m_row << '\n';
+
+    detail::write( m_streams , m_row.view() );
+
+    return *this;
+}
+
+template<typename... Columns>
+tableprinter::static_printer<Columns...>&
+tableprinter::static_printer<Columns...>::flush()
+{
+    for ( ::std::ostream& os : m_streams )
+        os.flush();
+
+    return *this;
+}
+
+template<typename... Columns>
+const ::std::vector<tableprinter::detail::osref>&
+tableprinter::static_printer<Columns...>::streams() const noexcept
+{
+    return m_streams;
+}
+
+template<typename... Columns>
+template<typename Column , typename T>
+void tableprinter::static_printer<Columns...>::print_cell( const T& val )
+{
+    constexpr const auto& plan { Column::plan };
+
+    if constexpr ( plan.has_width )
+        m_row.width( plan.width );
+
+    if constexpr ( plan.has_fill )
+        m_row.fill( plan.fill );
+
+    if constexpr ( plan.has_precision )
+        m_row.precision( plan.precision );
+
+    if constexpr ( plan.mask != ::std::ios_base::fmtflags {} )
+        m_row.setf( plan.flags , plan.mask );
+
+    m_row.insert( val );
+}
+
+template<typename... Columns>
+template<typename Column>
+void tableprinter::static_printer<Columns...>::print_header()
+{
+    constexpr const auto& plan { Column::plan };
+    constexpr auto adjust { plan.mask & ::std::ios_base::adjustfield };
+
+    if constexpr ( plan.has_width )
+        m_row.width( plan.width );
+
+    if constexpr ( adjust != ::std::ios_base::fmtflags {} )
+        m_row.setf( plan.flags & adjust , adjust );
+
+    m_row << Column::header;
+}
+
+tableprinter::concurrent_printer::concurrent_printer( ::std::vector<column> columns , ::std::vector<osref> streams )
+    :   m_printer { move( columns ) , move( streams ) }
+{   }
+
+tableprinter::concurrent_printer::concurrent_printer( ::std::vector<column> columns , ::std::ostream& stream )
+    :   m_printer { move( columns ) , stream }
+{   }
+
+template<typename... Ts>
+tableprinter::concurrent_printer& tableprinter::concurrent_printer::add_streams( ::std::ostream& os , Ts&... streams )
+{
+    ::std::lock_guard lock { m_mutex };
+
+    m_printer.add_streams( os , streams... );
+
+    return *this;
+}
+
+template<typename... Ts>
+tableprinter::concurrent_printer& tableprinter::concurrent_printer::remove_streams( ::std::ostream& os , Ts&... streams )
+{
+    ::std::lock_guard lock { m_mutex };
+
+    m_printer.remove_streams( os , streams... );
+
+    return *this;
+}
+
+template<typename... Ts>
+tableprinter::concurrent_printer& tableprinter::concurrent_printer::print( const Ts&... params )
+{
+    static_assert( sizeof...( Ts ) , "There must be arguments to print." );
+
+    auto& row { detail::local_row() };
+
+    row.reset();
+
+    m_printer.render( row , params... );
+
+    ::std::lock_guard lock { m_mutex };
+
+    m_printer.write( row );
+
+    return *this;
+}
+
+template<typename... Ts>
+tableprinter::concurrent_printer& tableprinter::concurrent_printer::print( const ::std::tuple<Ts...>& values )
+{
+    m_printer.throw_if_arguments_size_mismatch( sizeof...( Ts ) );
+
+    ::std::apply(
+        [ this ]( const Ts&... params )
+        {
+            print( params... );
+        } ,
+        values
+    );
+
+    return *this;
+}
+
+tableprinter::concurrent_printer& tableprinter::concurrent_printer::echo( ::std::string_view str )
+{
+    ::std::lock_guard lock { m_mutex };
+
+    m_printer.echo( str );
+
+    return *this;
+}
+
+tableprinter::concurrent_printer& tableprinter::concurrent_printer::print_headers()
+{
+    ::std::lock_guard lock { m_mutex };
+
+    m_printer.print_headers();
+
+    return *this;
+}
+
+const tableprinter::concurrent_printer& tableprinter::concurrent_printer::sanity_check() const
+{
+    m_printer.sanity_check();
+
+    return *this;
+}
+
+tableprinter::concurrent_printer& tableprinter::concurrent_printer::sanity_check()
+{
+    const auto& self { *this };
+
+    self.sanity_check();
+
+    return *this;
+}
+
+tableprinter::concurrent_printer& tableprinter::concurrent_printer::flush()
+{
+    ::std::lock_guard lock { m_mutex };
+
+    m_printer.flush();
+
+    return *this;
+}
+
+::std::vector<tableprinter::concurrent_printer::osref>
+tableprinter::concurrent_printer::streams() const
+{
+    ::std::lock_guard lock { m_mutex };
+
+    const auto& streams { m_printer.streams() };
+
+    return { begin( streams ) , end( streams ) };
+}
+
+tableprinter::async_printer::async_printer(
+    ::std::vector<column> columns ,
+    ::std::vector<osref>  streams ,
+    queue_capacity        capacity ,
+    overflow_policy       policy
+)
+    :   m_printer { move( columns ) , move( streams ) }
+    ,   m_policy { policy }
+    ,   m_queue { capacity }
+    ,   m_writer { [ this ]{ write_rows(); } }
+{   }
+
+tableprinter::async_printer::async_printer(
+    ::std::vector<column> columns ,
+    ::std::ostream& stream ,
+    queue_capacity  capacity ,
+    overflow_policy policy
+)
+    :   async_printer
+        {
+            move( columns ) ,
+            ::std::vector<osref>{ stream } ,
+            capacity ,
+            policy
         }
 {   }
 
+tableprinter::async_printer::~async_printer()
+{
+    {
+        ::std::lock_guard lock { m_mutex };
+
+        m_stop = true;
+    }
+
+    m_wakeup.notify_one();
+    m_writer.join();
+}
+
 template<typename... Ts>
-tableprinter::printer& tableprinter::printer::add_streams( std::ostream& os , Ts&... streams )
+tableprinter::async_printer& tableprinter::async_printer::add_streams( ::std::ostream& os , Ts&... streams )
 {
-    static_assert(
-        (::std::is_convertible_v<Ts& , ::std::ostream&> && ...) ,
-        "Ts should be inherited from 'std::ostream'"
-    );
+    drain();
 
-    m_streams.push_back( os );
-    ( m_streams.push_back( streams ) , ... );
+    ::std::lock_guard lock { m_streams_mutex };
+
+    m_printer.add_streams( os , streams... );
 
     return *this;
 }
 
 template<typename... Ts>
-tableprinter::printer& tableprinter::printer::remove_streams( ::std::ostream& os , Ts&... streams )
+tableprinter::async_printer& tableprinter::async_printer::remove_streams( ::std::ostream& os , Ts&... streams )
 {
-    static_assert(
-        (::std::is_convertible_v<Ts& , ::std::ostream&> && ...) ,
-        "Ts should be inherited from 'std::ostream'"
-    );
+    drain();
 
-    m_streams.erase(
-        remove_if(
-            begin( m_streams ) ,
-            end( m_streams ) ,
-            [ &os , &streams... ]( const osref& stream ){
-                return &os == &stream.get() ||
-                       ( ( addressof( streams ) == &stream.get() ) || ... );
-            }
-        ) ,
-        end( m_streams )
-    );
+    ::std::lock_guard lock { m_streams_mutex };
+
+    m_printer.remove_streams( os , streams... );
 
     return *this;
 }
 
 template<typename... Ts>
-tableprinter::printer& tableprinter::printer::print( const Ts&... params )
+tableprinter::async_printer& tableprinter::async_printer::print( const Ts&... params )
 {
     static_assert( sizeof...( Ts ) , "There must be arguments to print." );
 
-    for ( ::std::ostream& stream : m_streams )
+    auto& row { detail::local_row() };
+
+    row.reset();
+
+    m_printer.render( row , params... );
+
+    enqueue( row.view() );
+
+    if ( row.failed() )
     {
-        print_column<Ts...>( 0 , stream , params... );
+        ::std::lock_guard lock { m_streams_mutex };
 
-        stream << '\n';
+        detail::fail( m_printer.streams() );
     }
 
     return *this;
 }
 
 template<typename... Ts>
-tableprinter::printer& tableprinter::printer::print( const ::std::tuple<Ts...>& values )
+tableprinter::async_printer& tableprinter::async_printer::print( const ::std::tuple<Ts...>& values )
 {
-    if ( auto count = sizeof...( Ts ) != size( m_columns ) )
-        throw arguments_size_doesnt_match_with_columns {
-            "There are " +
-            ::std::to_string( size( m_columns ) ) +
-            " columns but given " +
-            ::std::to_string( count ) +
-            " arguments."
-        };
+    m_printer.throw_if_arguments_size_mismatch( sizeof...( Ts ) );
 
-    print_tuple( values , ::std::make_index_sequence<sizeof...( Ts )>() );
+    ::std::apply(
+        [ this ]( const Ts&... params )
+        {
+            print( params... );
+        } ,
+        values
+    );
 
     return *this;
 }
 
-tableprinter::printer& tableprinter::printer::echo( ::std::string_view str )
+tableprinter::async_printer& tableprinter::async_printer::echo( ::std::string_view str )
 {
-    for ( ::std::ostream& stream : m_streams )
-        stream << str << "\n";
+    auto& row { detail::local_row() };
+
+    row.discard();
+    row << str << '\n';
+
+    enqueue( row.view() );
 
     return *this;
 }
 
-tableprinter::printer& tableprinter::printer::print_headers()
+tableprinter::async_printer& tableprinter::async_printer::print_headers()
 {
-    for ( ::std::ostream& stream : m_streams )
-    {
-        for ( const auto& col : m_columns )
-        {
-            detail::run(
-                detail::overloaded {
-                    [ &stream ]( const width& w )
-                    {
-                        stream << ::std::setw( w );
-                    } ,
-                    [ &stream]( const left& )
-                    {
-                        stream << ::std::left;
-                    } ,
-                    [ &stream ]( const right& )
-                    {
-                        stream << ::std::right;
-                    }
-                } ,
-                col.options
-            );
+    auto& row { detail::local_row() };
 
-            bool printed {};
-
-            detail::run(
-                [ &stream , &printed ]( const name& n )
-                {
-                    printed = true;
-                    stream << n.value;
-                } ,
-                col.options
-            );
+    row.discard();
+    row.reset();
 
-            if ( !printed )
-                stream << "";
-        }
+    m_printer.render_headers( row );
 
-        stream << '\n';
-    }
+    enqueue( row.view() );
 
     return *this;
 }
 
-const tableprinter::printer& tableprinter::printer::sanity_check() const
+const tableprinter::async_printer& tableprinter::async_printer::sanity_check() const
 {
-    for ( const column& column : m_columns )
-    {
-        throw_if_duplicate_opt<name>( column , "Multiple 'name' options are not sane." );
-        throw_if_duplicate_opt<width>( column , "Multiple 'width' options are not sane.");
-        throw_if_duplicate_opt<precision>( column , "Multiple 'precision' options are not sane." );
-        throw_if_duplicate_opt<fill>( column , "Multiple 'fill' options are not sane." );
-        throw_if_both_left_and_right_opt( column );
-        throw_if_both_precision_and_default_precision_opt( column );
-        throw_if_both_fixed_and_unfixed_opt( column );
-    }
+    m_printer.sanity_check();
 
     return *this;
 }
 
-tableprinter::printer& tableprinter::printer::sanity_check()
+tableprinter::async_printer& tableprinter::async_printer::sanity_check()
 {
     const auto& self { *this };
 
@@ -571,147 +3403,175 @@ tableprinter::printer& tableprinter::printer::sanity_check()
     return *this;
 }
 
-tableprinter::printer& tableprinter::printer::flush()
+tableprinter::async_printer& tableprinter::async_printer::flush()
 {
-    for ( ::std::ostream& os : m_streams )
-        os.flush();
+    drain();
+
+    ::std::lock_guard lock { m_streams_mutex };
+
+    m_printer.flush();
 
     return *this;
 }
 
-const ::std::vector<tableprinter::printer::osref>&
-tableprinter::printer::streams() const noexcept
+::std::size_t tableprinter::async_printer::dropped() const noexcept
 {
-    return m_streams;
+    return m_dropped.load( ::std::memory_order_relaxed );
 }
 
-template<typename H , typename... T>
-void tableprinter::printer::print_column( int col , ::std::ostream& os , const H& val , const T&... rest )
+::std::vector<tableprinter::async_printer::osref>
+tableprinter::async_printer::streams() const
 {
-    if constexpr ( detail::is_sequence_v<H> )
-    {
-        for ( auto itr = val.beg; !( itr == val.end ); ++itr , ++col )
-            print_column( col , os , *itr );
-    }
-    else
-    {
-        const auto& options { m_columns[ col++ ].options };
-
-        detail::run(
-            detail::overloaded {
-                [ &os ]( const width& w )
-                {
-                    os << ::std::setw( w );
-                } ,
-                [ &os ]( const fill& f )
-                {
-                    os << ::std::setfill( f.value );
-                } ,
-                [ &os ]( const precision& p )
-                {
-                    os << ::std::setprecision( p );
-                } ,
-                [ &os ]( const default_precision& )
-                {
-                    os << ::std::setprecision( 6 );
-                } ,
-                [ &os ]( const fixed& f )
-                {
-                    os << ::std::fixed;
-                } ,
-                [ &os ]( const unfixed& )
-                {
-                    os.unsetf( ::std::ios_base::fixed );
-                } ,
-                [ &os ]( const left& )
-                {
-                    os << ::std::left;
-                } ,
-                [ &os ]( const right& )
-                {
-                    os << ::std::right;
-                } ,
-                [ &os ]( const hex& )
-                {
-                    os << ::std::hex;
-                } ,
-                [ &os ]( const decimal& )
-                {
-                    os << ::std::dec;
-                } ,
-                [ &os ]( const octal& )
-                {
-                    os << ::std::oct;
-                }
-            } ,
-            options
-        );
+    ::std::lock_guard lock { m_streams_mutex };
 
-        os << val;
-    }
+    const auto& streams { m_printer.streams() };
 
-    if constexpr ( bool( sizeof...( rest ) ) )
-        print_column( col , os , rest... );
+    return { begin( streams ) , end( streams ) };
 }
 
-template<typename... Ts , ::std::size_t... Idx>
-void tableprinter::printer::print_tuple( const ::std::tuple<Ts...>& values , ::std::index_sequence<Idx...> )
+void tableprinter::async_printer::enqueue( ::std::string_view row )
 {
-    print( ::std::get<Idx>( values )... );
-}
+    auto fill = [ row ]( ::std::string& slot )
+    {
+        slot.assign( data( row ) , size( row ) );
+    };
 
-template<typename T>
-void tableprinter::printer::throw_if_duplicate_opt( const column& col , ::std::string_view error ) const
-{
-    auto opts = detail::filter_opts<T>( col.options );
+    m_pending.fetch_add( 1 );
 
-    if ( size( opts ) > 1 )
+    while ( !m_queue.push( fill ) )
     {
-        ::std::string concatenated;
+        if ( m_policy == overflow_policy::drop_newest )
+        {
+            m_pending.fetch_sub( 1 );
+            m_dropped.fetch_add( 1 , ::std::memory_order_relaxed );
 
-        throw duplicate_option {
-            ::std::string { error } +
-            " " +
-            detail::concat( opts )
-        };
+            return;
+        }
+
+        if ( m_policy == overflow_policy::drop_oldest )
+        {
+            if ( m_queue.pop( []( ::std::string& ){} ) )
+            {
+                m_pending.fetch_sub( 1 );
+                m_dropped.fetch_add( 1 , ::std::memory_order_relaxed );
+            }
+
+            continue;
+        }
+
+        // Blocked producers sleep until the writer frees a slot, the fences
+        // pair with the one after 'pop' so that either the push sees the
+        // slot or the writer sees the producer.
+        ::std::unique_lock lock { m_mutex };
+
+        m_blocked.fetch_add( 1 );
+        ::std::atomic_thread_fence( ::std::memory_order_seq_cst );
+
+        m_space.wait(
+            lock ,
+            [ this , &fill ]
+            {
+                return m_queue.push( fill );
+            }
+        );
+
+        m_blocked.fetch_sub( 1 );
+
+        break;
     }
-}
 
-void tableprinter::printer::throw_if_both_left_and_right_opt( const column& col ) const
-{
-    auto lefts  = detail::filter_opts<left>( col.options );
-    auto rights = detail::filter_opts<right>( col.options );
+    ::std::atomic_thread_fence( ::std::memory_order_seq_cst );
 
-    if ( !empty( lefts ) && !empty( rights ) )
+    if ( m_idle.load( ::std::memory_order_relaxed ) )
     {
-        throw both_left_and_right_option {
-            "Specifying both 'left' and 'right' options are not sane."
-        };
+        ::std::lock_guard lock { m_mutex };
+
+        m_wakeup.notify_one();
     }
 }
 
-void tableprinter::printer::throw_if_both_precision_and_default_precision_opt( const column& col ) const
+void tableprinter::async_printer::drain()
 {
-    auto precisions    = detail::filter_opts<precision>( col.options );
-    auto default_precs = detail::filter_opts<default_precision>( col.options );
+    ::std::unique_lock lock { m_mutex };
 
-    if ( !empty( precisions ) && !empty( default_precs ) )
-    {
-        throw both_precision_and_default_precision {
-            "Specifying both 'precision' and 'default_precision' options are not sane."
-        };
-    }
+    m_drained.wait(
+        lock ,
+        [ this ]
+        {
+            return m_pending.load() == 0;
+        }
+    );
+
+    if ( m_error )
+        ::std::rethrow_exception( ::std::exchange( m_error , nullptr ) );
 }
 
-void tableprinter::printer::throw_if_both_fixed_and_unfixed_opt( const column& col ) const
+void tableprinter::async_printer::write_rows()
 {
-    auto fixeds   = detail::filter_opts<fixed>( col.options );
-    auto unfixeds = detail::filter_opts<unfixed>( col.options );
+    ::std::string row;
 
-    if ( !empty( fixeds ) && !empty( unfixeds ) )
+    for ( ;; )
     {
-        throw both_fixed_and_unfixed {
-            "Specifying both 'fixed' and 'unfixed' options are not sane."
-        };
+        {
+            ::std::lock_guard lock { m_streams_mutex };
+
+            while (
+                m_queue.pop(
+                    [ &row ]( ::std::string& slot )
+                    {
+                        row.swap( slot );
+                    }
+                )
+            )
+            {
+                ::std::atomic_thread_fence( ::std::memory_order_seq_cst );
+
+                if ( m_blocked.load( ::std::memory_order_relaxed ) )
+                {
+                    ::std::lock_guard lock { m_mutex };
+
+                    m_space.notify_one();
+                }
+
+                // A stream throwing on the writer thread must neither end the
+                // process nor leave the row pending, the first exception is
+                // kept for 'flush' to rethrow.
+                try
+                {
+                    m_printer.write( row );
+                }
+                catch ( ... )
+                {
+                    ::std::lock_guard lock { m_mutex };
+
+                    if ( !m_error )
+                        m_error = ::std::current_exception();
+                }
+
+                m_pending.fetch_sub( 1 );
+            }
+        }
+
+        ::std::unique_lock lock { m_mutex };
+
+        m_idle.store( true , ::std::memory_order_relaxed );
+        m_drained.notify_all();
+
+        // A row counted in 'm_pending' may still be being pushed, the writer
+        // waits for its slot to be published instead of spinning on it.
+        m_wakeup.wait(
+            lock ,
+            [ this ]
+            {
+                ::std::atomic_thread_fence( ::std::memory_order_seq_cst );
+
+                return m_stop || m_queue.ready();
+            }
+        );
+
+        m_idle.store( false );
+
+        if ( m_stop && m_pending.load() == 0 )
+            return;
     }
-}
+}
\ No newline at end of file
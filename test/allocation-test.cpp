@@ -0,0 +1,230 @@
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <string_view>
+#include <tuple>
+#include <vector>
+#include <tableprinter/tableprinter.hpp>
+
+namespace
+{
+
+std::atomic<bool> counting {};
+std::atomic<std::size_t> allocations {};
+
+void* allocate( std::size_t size )
+{
+    if ( counting.load( std::memory_order_relaxed ) )
+        allocations.fetch_add( 1 , std::memory_order_relaxed );
+
+    if ( void* ptr = std::malloc( size ? size : 1 ) )
+        return ptr;
+
+    throw std::bad_alloc {};
+}
+
+// Counts the allocations made while it is alive.
+class allocation_counter
+{
+public:
+
+    allocation_counter()
+    {
+        allocations = 0;
+        counting = true;
+    }
+
+    ~allocation_counter()
+    {
+        counting = false;
+    }
+
+    std::size_t count() const noexcept
+    {
+        return allocations.load();
+    }
+};
+
+// Discards everything written to it without allocating.
+class null_buffer : public std::streambuf
+{
+protected:
+
+    int_type overflow( int_type ch ) override
+    {
+        return traits_type::not_eof( ch );
+    }
+
+    std::streamsize xsputn( const char* , std::streamsize n ) override
+    {
+        return n;
+    }
+};
+
+}
+
+void* operator new( std::size_t size )
+{
+    return allocate( size );
+}
+
+void* operator new[]( std::size_t size )
+{
+    return allocate( size );
+}
+
+void operator delete( void* ptr ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete[]( void* ptr ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete( void* ptr , std::size_t ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete[]( void* ptr , std::size_t ) noexcept
+{
+    std::free( ptr );
+}
+
+TEST_CASE( "Printing rows does not allocate after the first one" , "[allocation]" )
+{
+    using namespace tableprinter;
+
+    null_buffer buffer;
+    std::ostream first { &buffer } , second { &buffer };
+
+    std::vector<column> columns
+    {
+        { name { "id" } , width { 6 } } ,
+        { name { "name" } , width { 12 } , left {} } ,
+        { name { "score" } , width { 10 } , fixed {} , precision { 2 } } ,
+        { name { "ratio" } , precision { 3 } } ,
+        { name { "mask" } , hex {} , auto_width {} }
+    };
+
+    const std::string_view names[] = { "Lucy" , "Alexander" , "Al" };
+
+    auto print_rows = []( printer& p , const std::string_view* names )
+    {
+        for ( int i = 0; i < 64; ++i )
+            p.print( i * 7919 , names[ i % 3 ] , i * 1.25 , 1.0f / float( i + 1 ) , unsigned( i ) );
+    };
+
+    for ( bool render_once : { false , true } )
+    {
+        printer p { columns , { first , second } };
+
+        p.render_once( render_once );
+        p.print( 0xFFFFFFFFu , "warm up" , 1e6 , 1.0f , 0xFFFFFFFFu );
+
+        allocation_counter counter;
+
+        print_rows( p , names );
+
+        REQUIRE( counter.count() == 0 );
+    }
+
+    concurrent_printer p { columns , { first , second } };
+
+    p.print( 0xFFFFFFFFu , "warm up" , 1e6 , 1.0f , 0xFFFFFFFFu );
+
+    allocation_counter counter;
+
+    for ( int i = 0; i < 64; ++i )
+        p.print( i * 7919 , names[ i % 3 ] , i * 1.25 , 1.0f / float( i + 1 ) , unsigned( i ) );
+
+    REQUIRE( counter.count() == 0 );
+}
+
+TEST_CASE( "Printing batches does not allocate after the first one" , "[allocation]" )
+{
+    using namespace tableprinter;
+
+    null_buffer buffer;
+    std::ostream os { &buffer };
+
+    std::vector<column> columns
+    {
+        { width { 6 } } ,
+        { width { 12 } , left {} } ,
+        { width { 10 } , fixed {} , precision { 2 } }
+    };
+
+    std::vector<std::tuple<int , std::string_view , double>> rows;
+    std::vector<int> ids;
+    std::vector<std::string_view> names;
+    std::vector<double> scores;
+
+    for ( int i = 0; i < 4096; ++i )
+    {
+        rows.emplace_back( i , "name" , i / 3.0 );
+        ids.push_back( i );
+        names.push_back( "name" );
+        scores.push_back( i / 3.0 );
+    }
+
+    printer p { columns , os };
+
+    p.render_once();
+    p.print_rows( rows );
+    p.print_columns( ids , names , scores );
+
+    allocation_counter counter;
+
+    p.print_rows( rows );
+    p.print_columns( ids , names , scores );
+
+    REQUIRE( counter.count() == 0 );
+}
+
+#ifdef TABLEPRINTER_PMR
+
+TEST_CASE( "A printer backed by a memory resource does not use the heap" , "[allocation]" )
+{
+    using namespace tableprinter;
+
+    null_buffer buffer;
+    std::ostream os { &buffer };
+
+    const std::vector<column> columns
+    {
+        { name { "id" } , width { 6 } } ,
+        { name { "name" } , width { 12 } , left {} } ,
+        { name { "score" } , width { 10 } , fixed {} , precision { 2 } , auto_width {} }
+    };
+
+    alignas( std::max_align_t ) std::byte arena[ 1 << 16 ];
+
+    allocation_counter counter;
+
+    for ( int request = 0; request < 4; ++request )
+    {
+        std::pmr::monotonic_buffer_resource resource { arena , sizeof( arena ) , std::pmr::null_memory_resource() };
+
+        printer p { columns , { os , os } , &resource };
+
+        p.print_headers();
+
+        for ( bool render_once : { false , true } )
+        {
+            p.render_once( render_once );
+
+            for ( int i = 0; i < 64; ++i )
+                p.print( i , std::string_view { "name" } , i * 1.25 );
+        }
+    }
+
+    REQUIRE( counter.count() == 0 );
+}
+
+#endif
@@ -1,7 +1,12 @@
 #define CATCH_CONFIG_MAIN
 #include"catch.hpp"
 #include <sstream>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 #include <tableprinter/tableprinter.hpp>
+#include <tableprinter/sinks.hpp>
 
 TEST_CASE( "sequence if there are arguments after it" , "[printer]" )
 {
@@ -123,7 +128,9 @@ TEST_CASE( "Retrieve streams" , "[streams]" )
         { ss1 , ss2 , ss3 }
     };
 
-    REQUIRE( std::size( p.streams() ) == 3 );
+    const std::vector<printer::osref>& streams { p.streams() };
+
+    REQUIRE( std::size( streams ) == 3 );
 }
 
 TEST_CASE( "Remove streams" , "[remove_streams]" )
@@ -177,6 +184,525 @@ TEST_CASE( "Add streams" , "[add_streams]" )
     REQUIRE( ss.str() == "456\n789\n789\n789\n" );
 }
 
+TEST_CASE( "Render a row once and write it to every stream" , "[render_once]" )
+{
+    using namespace tableprinter;
+
+    std::stringstream ss1 , ss2;
+    ss2 << std::setprecision( 2 ) << std::hex;
+
+    printer p
+    {
+        {
+            { name { "col-1" } , width { 8 } , fixed {} , precision { 3 } } ,
+            { name { "col-2" } , width { 4 } } ,
+            { name { "col-3" } }
+        } ,
+        { ss1 , ss2 }
+    };
+
+    p.render_once()
+     .print( 1.5 , 15 , 0.1234 )
+     .print( 2.0 , 16 , "str" );
+
+    REQUIRE( ss1.str() == "   1.500  150.123\n   2.000  16str\n" );
+    REQUIRE( ss2.str() == ss1.str() );
+}
+
+TEST_CASE( "Rendered arithmetic values match stream output" , "[render_once]" )
+{
+    using namespace tableprinter;
+
+    std::vector<column> columns
+    {
+        { width { 6 } , fill { '*' } , left {} } ,
+        { width { 10 } , hex {} } ,
+        { octal {} } ,
+        { decimal {} , width { 5 } } ,
+        { width { 12 } , fixed {} , precision { 3 } } ,
+        { unfixed {} , default_precision {} } ,
+        { precision { 0 } } ,
+        { width { 3 } , precision { 10 } }
+    };
+
+    std::stringstream expected , actual;
+
+    printer by_streams { columns , expected };
+    printer by_render { columns , actual };
+
+    by_render.render_once();
+
+    auto print = [ &by_streams , &by_render ]( const auto&... values )
+    {
+        by_streams.print( values... );
+        by_render.print( values... );
+    };
+
+    print( -42 , -1 , short( -1 ) , 7ull , 3.14159f , 1e-5 , 12.5 , -0.0 );
+    print( 0 , 255l , 8u , -123456789ll , -1e15 , 123456789.0 , 0.5f , 1.0 / 3 );
+    print( "txt" , std::string { "str" } , 'c' , true , 2.5 , 1e300 , 9.99 , 1e22 );
+
+    REQUIRE( actual.str() == expected.str() );
+}
+
+namespace
+{
+    constexpr char id_name[]    = "id";
+    constexpr char score_name[] = "score";
+}
+
+TEST_CASE( "Static printer prints like a printer with the same columns" , "[static_printer]" )
+{
+    using namespace tableprinter;
+
+    std::stringstream expected , actual;
+
+    printer p
+    {
+        {
+            { name { "id" } , width { 6 } , hex {} , left {} } ,
+            { width { 4 } , fill { '.' } } ,
+            { name { "score" } , width { 9 } , fixed {} , precision { 2 } , right {} }
+        } ,
+        expected
+    };
+
+    static_printer<
+        static_column<static_name<id_name> , static_width<6> , hex , left> ,
+        static_column<static_width<4> , static_fill<'.'>> ,
+        static_column<static_name<score_name> , static_width<9> , fixed , static_precision<2> , right>
+    > sp { actual };
+
+    p.render_once();
+
+    p.print_headers().print( 255 , "ab" , 3.14159 ).print( std::make_tuple( 16 , 'c' , -2.5f ) );
+    sp.print_headers().print( 255 , "ab" , 3.14159 ).print( std::make_tuple( 16 , 'c' , -2.5f ) );
+
+    REQUIRE( actual.str() == expected.str() );
+}
+
+namespace
+{
+
+// Counts the calls writing more than one character at once.
+struct write_counter : std::stringbuf
+{
+    std::streamsize xsputn( const char* s , std::streamsize n ) override
+    {
+        ++writes;
+
+        return std::stringbuf::xsputn( s , n );
+    }
+
+    int writes {};
+};
+
+}
+
+TEST_CASE( "Print rows of a range" , "[print_rows]" )
+{
+    using namespace tableprinter;
+
+    struct score
+    {
+        int         id;
+        std::string name;
+        double      value;
+    };
+
+    std::vector<score> scores
+    {
+        { 1 , "Lucy" , 94.13 } ,
+        { 2 , "Roger" , 77.1 } ,
+        { 3 , "Anna" , 87.135 }
+    };
+
+    std::vector<column> columns
+    {
+        { name { "id" } , width { 4 } } ,
+        { name { "name" } , width { 8 } } ,
+        { name { "score" } , width { 8 } , fixed {} , precision { 2 } }
+    };
+
+    std::stringstream expected;
+
+    printer { columns , expected }.print( 1 , "Lucy" , 94.13 )
+                                  .print( 2 , "Roger" , 77.1 )
+                                  .print( 3 , "Anna" , 87.135 );
+
+    SECTION( "with projections" )
+    {
+        std::stringstream ss1 , ss2;
+
+        printer { columns , ss1 }.print_rows( scores , &score::id , &score::name , &score::value );
+        printer { columns , ss2 }.render_once()
+                                 .print_rows(
+                                     scores ,
+                                     &score::id ,
+                                     []( const score& s ){ return std::string_view { s.name }; } ,
+                                     &score::value
+                                 );
+
+        REQUIRE( ss1.str() == expected.str() );
+        REQUIRE( ss2.str() == expected.str() );
+
+        printer p { columns , ss1 };
+
+        REQUIRE_THROWS_AS( p.print_rows( scores , &score::id , &score::name ) , arguments_size_doesnt_match_with_columns );
+        REQUIRE_THROWS_AS(
+            p.print_rows( scores , &score::id , &score::name , &score::value , &score::id ) ,
+            arguments_size_doesnt_match_with_columns
+        );
+    }
+
+    SECTION( "in one write per stream with render_once" )
+    {
+        write_counter counter1 , counter2;
+        std::ostream os1 { &counter1 } , os2 { &counter2 };
+
+        printer p { columns , { os1 , os2 } };
+
+        p.render_once().print_rows( scores , &score::id , &score::name , &score::value );
+
+        REQUIRE( counter1.str() == expected.str() );
+        REQUIRE( counter2.str() == expected.str() );
+        REQUIRE( counter1.writes == 1 );
+        REQUIRE( counter2.writes == 1 );
+    }
+
+    SECTION( "of tuples" )
+    {
+        std::vector<std::tuple<int , const char* , double>> tuples
+        {
+            { 1 , "Lucy" , 94.13 } ,
+            { 2 , "Roger" , 77.1 } ,
+            { 3 , "Anna" , 87.135 }
+        };
+
+        std::stringstream ss;
+
+        printer { columns , ss }.render_once().print_rows( tuples );
+
+        REQUIRE( ss.str() == expected.str() );
+
+        std::vector<std::tuple<int>> short_tuples { { 1 } };
+        printer p { columns , ss };
+
+        REQUIRE_THROWS_AS( p.print_rows( short_tuples ) , arguments_size_doesnt_match_with_columns );
+    }
+}
+
+TEST_CASE( "Print columns of parallel arrays" , "[print_columns]" )
+{
+    using namespace tableprinter;
+
+    std::vector<column> columns
+    {
+        { width { 4 } , hex {} } ,
+        { } ,
+        { width { 9 } , fixed {} , precision { 2 } } ,
+        { width { 7 } , fill { '.' } , left {} }
+    };
+
+    std::vector<int>         ids ( 3000 );
+    std::vector<double>      values ( 3000 );
+    std::vector<float>       scores ( 3000 );
+    std::vector<std::string> names ( 3000 );
+
+    for ( int i = 0; i < 3000; ++i )
+    {
+        ids[ i ]    = i;
+        values[ i ] = i / 7.0;
+        scores[ i ] = i * 1.5f;
+        names[ i ]  = std::string( i % 5 , 'a' + i % 26 );
+    }
+
+    for ( std::size_t rows : { std::size_t { 1 } , std::size_t { 3000 } } )
+    {
+        std::stringstream expected , actual;
+        expected << std::setprecision( 3 );
+        actual << std::setprecision( 3 );
+
+        printer by_rows { columns , expected };
+        printer by_columns { columns , actual };
+
+        by_rows.render_once();
+        by_columns.render_once();
+
+        for ( std::size_t i = 0; i < rows; ++i )
+            by_rows.print( ids[ i ] , values[ i ] , scores[ i ] , names[ i ] );
+
+        by_rows.print( 1 , 1.0 / 3 , 2.0f , "end" );
+
+        by_columns.print_columns(
+            std::vector<int> { begin( ids ) , begin( ids ) + rows } ,
+            std::vector<double> { begin( values ) , begin( values ) + rows } ,
+            std::vector<float> { begin( scores ) , begin( scores ) + rows } ,
+            std::vector<std::string> { begin( names ) , begin( names ) + rows }
+        ).print( 1 , 1.0 / 3 , 2.0f , "end" );
+
+        REQUIRE( actual.str() == expected.str() );
+    }
+
+    std::stringstream by_streams;
+    write_counter counter;
+    std::ostream by_batches { &counter };
+
+    printer { columns , by_streams }.print_columns( ids , values , scores , names );
+    printer { columns , by_batches }.render_once().print_columns( ids , values , scores , names );
+
+    REQUIRE( counter.str() == by_streams.str() );
+    REQUIRE( counter.writes == 1 );
+
+    std::stringstream ss;
+    printer p { columns , ss };
+    int short_column[] = { 1 , 2 };
+
+    REQUIRE_THROWS_AS( p.print_columns( short_column , values , scores , names ) , columns_length_mismatch );
+}
+
+TEST_CASE( "Auto width columns grow to their longest cell" , "[auto_width]" )
+{
+    using namespace tableprinter;
+
+    std::vector<column> columns
+    {
+        { name { "id" } , auto_width {} , right {} } ,
+        { name { "label" } , width { 3 } , auto_width {} , left {} }
+    };
+
+    std::stringstream by_streams , by_render , by_columns;
+
+    printer { columns , by_streams }
+        .print_headers()
+        .print( 1 , "a" )
+        .print( 12345 , "abcdefgh" )
+        .print( 7 , "b" );
+
+    printer { columns , by_render }
+        .render_once()
+        .print_headers()
+        .print( 1 , "a" )
+        .print( 12345 , "abcdefgh" )
+        .print( 7 , "b" );
+
+    const int ids[] = { 1 , 12345 , 7 };
+    const std::string_view labels[] = { "a" , "abcdefgh" , "b" };
+
+    printer { columns , by_columns }
+        .render_once()
+        .print_headers()
+        .print_columns( ids , labels );
+
+    REQUIRE( by_streams.str() == "idlabel\n 1a    \n12345abcdefgh\n    7b       \n" );
+    REQUIRE( by_render.str() == by_streams.str() );
+    REQUIRE( by_columns.str() == by_streams.str() );
+}
+
+namespace
+{
+
+struct thousands : std::numpunct<char>
+{
+    char do_thousands_sep() const override { return ','; }
+    std::string do_grouping() const override { return "\3"; }
+};
+
+}
+
+TEST_CASE( "Auto width cells follow the locale of each stream" , "[auto_width]" )
+{
+    using namespace tableprinter;
+
+    std::stringstream plain , grouped;
+
+    grouped.imbue( std::locale { std::locale::classic() , new thousands } );
+
+    printer p { { { name { "n" } , auto_width {} , right {} } } , { plain , grouped } };
+
+    p.print( 1234567 ).print( 89 ).print_headers();
+
+    REQUIRE( plain.str() == "1234567\n     89\n      n\n" );
+    REQUIRE( grouped.str() == "1,234,567\n       89\n        n\n" );
+
+    std::stringstream added;
+
+    p.remove_streams( plain ).add_streams( added ).print( 1000 );
+
+    REQUIRE( grouped.str() == "1,234,567\n       89\n        n\n    1,000\n" );
+    REQUIRE( added.str() == "1000\n" );
+}
+
+TEST_CASE( "Print a table sized to its longest cells" , "[print_table]" )
+{
+    using namespace tableprinter;
+
+    struct player
+    {
+        int id;
+        std::string name;
+        double score;
+    };
+
+    const std::vector<player> players
+    {
+        { 1 , "Lucy" , 3.5 } ,
+        { -1024 , "Alexander" , 17.25 } ,
+        { 7 , "Al" , 100 }
+    };
+
+    std::stringstream ss;
+
+    printer
+    {
+        {
+            { name { "id" } , auto_width {} , right {} } ,
+            { name { "name" } , width { 6 } , auto_width {} , left {} } ,
+            { name { "score" } , auto_width {} , right {} , fixed {} , precision { 2 } }
+        } ,
+        ss
+    }
+    .print_table( players , &player::id , &player::name , &player::score )
+    .print_headers();
+
+    REQUIRE( ss.str() ==
+        "    1Lucy       3.50\n"
+        "-1024Alexander 17.25\n"
+        "    7Al       100.00\n"
+        "   idname      score\n"
+    );
+
+    std::vector<column> columns
+    {
+        { width { 6 } , hex {} } ,
+        { width { 3 } , fill { '*' } , left {} } ,
+        { precision { 3 } }
+    };
+
+    const std::vector<std::tuple<long , const char* , float>> rows
+    {
+        { 255 , "a" , 1.0f / 3 } ,
+        { -1 , "abcd" , 2e10f } ,
+        { 4096 , "" , -0.5f }
+    };
+
+    std::stringstream by_rows , by_table;
+
+    printer { columns , by_rows }.render_once().print_rows( rows ).print_rows( rows );
+    printer { columns , by_table }.print_table( rows ).print_table( rows );
+
+    REQUIRE( by_table.str() == by_rows.str() );
+}
+
+TEST_CASE( "Rendered integers match stream output" , "[render_once]" )
+{
+    using namespace tableprinter;
+
+    std::vector<column> columns
+    {
+        { width { 21 } , fill { '0' } } ,
+        { width { 17 } , hex {} , left {} } ,
+        { octal {} , width { 23 } } ,
+        { decimal {} }
+    };
+
+    std::stringstream expected , actual;
+
+    printer by_streams { columns , expected };
+    printer by_render { columns , actual };
+
+    by_render.render_once();
+
+    unsigned long long power { 1 };
+
+    for ( int i = 0; i < 20; ++i , power *= 10 )
+    {
+        for ( unsigned long long value : { power - 1 , power , power + 1 } )
+        {
+            by_streams.print( value , value , value , -static_cast<long long>( value ) );
+            by_render.print( value , value , value , -static_cast<long long>( value ) );
+            by_streams.print( int( value ) , short( value ) , long( value ) , unsigned( value ) );
+            by_render.print( int( value ) , short( value ) , long( value ) , unsigned( value ) );
+        }
+    }
+
+    by_streams.print( std::numeric_limits<long long>::min() , -1 , -1ll , std::numeric_limits<unsigned long long>::max() );
+    by_render.print( std::numeric_limits<long long>::min() , -1 , -1ll , std::numeric_limits<unsigned long long>::max() );
+
+    REQUIRE( actual.str() == expected.str() );
+}
+
+TEST_CASE( "Rendered fixed floating point values match stream output" , "[render_once]" )
+{
+    using namespace tableprinter;
+
+    std::vector<column> columns
+    {
+        { fixed {} , precision { 0 } } ,
+        { fixed {} , precision { 2 } , width { 12 } } ,
+        { fixed {} , precision { 3 } , width { 12 } , left {} } ,
+        { fixed {} , default_precision {} , width { 14 } } ,
+        { fixed {} , precision { 12 } }
+    };
+
+    std::stringstream expected , actual;
+
+    printer by_streams { columns , expected };
+    printer by_render { columns , actual };
+
+    by_render.render_once();
+
+    for ( int i = -2000; i <= 2000; ++i )
+    {
+        const double ties { i / 8.0 };
+        const double cents { i * 0.005 };
+        const float  single { i * 0.3f };
+
+        by_streams.print( ties , ties , cents , single , i * 1e-7 );
+        by_render.print( ties , ties , cents , single , i * 1e-7 );
+    }
+
+    for ( double value : { 0.0 , -0.0 , 5e-324 , 1e-300 , 1.8e19 , 1e300 , -94.13 , 98.34 } )
+    {
+        by_streams.print( value , value , value , value , value );
+        by_render.print( value , value , value , value , value );
+    }
+
+    REQUIRE( actual.str() == expected.str() );
+}
+
+TEST_CASE( "Rendered strings match stream output" , "[render_once]" )
+{
+    using namespace tableprinter;
+
+    std::vector<column> columns
+    {
+        { width { 8 } , fill { '.' } } ,
+        { width { 8 } , left {} } ,
+        { width { 2 } , right {} } ,
+        { width { 6 } } ,
+        { }
+    };
+
+    std::stringstream expected , actual;
+
+    printer by_streams { columns , expected };
+    printer by_render { columns , actual };
+
+    by_render.render_once();
+
+    const std::string str { "Lucy" };
+    const std::string_view view { "identifier" };
+    char buffer[] = "abc";
+
+    by_streams.print( str , view , "x" , buffer , "" );
+    by_render.print( str , view , "x" , buffer , "" );
+    by_streams.print( view , "" , str , static_cast<char*>( buffer ) , std::string {} );
+    by_render.print( view , "" , str , static_cast<char*>( buffer ) , std::string {} );
+
+    REQUIRE( actual.str() == expected.str() );
+}
+
 TEST_CASE( "Should be constructed without outputs" )
 {
     using namespace tableprinter;
@@ -351,6 +877,27 @@ TEST_CASE( "Take precision option into account while printing" , "[print]" )
     REQUIRE( ss.str() == "5.3434532341\n" );
 }
 
+TEST_CASE( "Latest option of the same kind wins while printing" , "[print]" )
+{
+    using namespace tableprinter;
+
+    std::stringstream ss;
+    ss << std::scientific;
+
+    printer p
+    {
+        {
+            { width { 3 } , width { 6 } , left {} , right {} , fixed {} , unfixed {} , precision { 2 } } ,
+            { hex {} , octal {} }
+        } ,
+        ss
+    };
+
+    p.print( 1.5 , 15 ).print( 2.25 , 8 );
+
+    REQUIRE( ss.str() == "   1.517\n   2.210\n" );
+}
+
 TEST_CASE( "If there are less elements in tuple than columns, should throw exception" , "[print]" )
 {
     using namespace tableprinter;
@@ -486,6 +1033,73 @@ TEST_CASE( "Take into account left option while printing headers" , "[print_head
     REQUIRE( ss.str() == "col-2   \n" );
 }
 
+TEST_CASE( "Columns with one option of each kind are sane" , "[sanity_check]" )
+{
+    using namespace tableprinter;
+
+    std::stringstream ss;
+
+    printer p
+    {
+        {
+            { name { "col-1" } , width { 5 } , precision { 3 } , fill { '-' } , left {} , fixed {} , hex {} } ,
+            { name { "col-2" } , default_precision {} , right {} , unfixed {} , octal {} , decimal {} } ,
+            { }
+        } ,
+        ss
+    };
+
+    REQUIRE_NOTHROW( p.sanity_check() );
+}
+
+TEST_CASE( "Duplicate option exception lists the duplicated values" , "[sanity_check]" )
+{
+    using namespace tableprinter;
+
+    std::stringstream ss;
+
+    printer p
+    {
+        {
+            { width { 5 } , name { "col" } , width { 3 } }
+        } ,
+        ss
+    };
+
+    REQUIRE_THROWS_WITH( p.sanity_check() , "Multiple 'width' options are not sane. [ '5' '3' ]" );
+}
+
+TEST_CASE( "Columns keep every option beyond the inline ones" , "[sanity_check]" )
+{
+    using namespace tableprinter;
+
+    column col
+    {
+        name { "a long column name which is not stored inline" } ,
+        fill { '.' } ,
+        left {} ,
+        hex {} ,
+        fixed {} ,
+        precision { 2 } ,
+        width { 1 } ,
+        width { 2 }
+    };
+
+    column copy { col };
+    column moved { std::move( copy ) };
+    copy = moved;
+
+    REQUIRE( col.options.size() == 8 );
+    REQUIRE( moved.options.size() == 8 );
+    REQUIRE( copy.options.size() == 8 );
+
+    std::stringstream ss;
+
+    printer p { { col , moved } , ss };
+
+    REQUIRE_THROWS_WITH( p.sanity_check() , "Multiple 'width' options are not sane. [ '1' '2' ]" );
+}
+
 TEST_CASE( "If there are two 'name' options, should throw exception" , "[sanity_check]" )
 {
     using namespace tableprinter;
@@ -603,4 +1217,463 @@ TEST_CASE( "If both 'precision' and 'default_precision' options are specified, s
     };
 
     REQUIRE_THROWS_AS( p.sanity_check() , tableprinter::both_precision_and_default_precision );
-}
\ No newline at end of file
+}
+
+TEST_CASE( "Rows printed from multiple threads do not interleave" , "[concurrent_printer]" )
+{
+    using namespace tableprinter;
+
+    std::stringstream ss;
+
+    concurrent_printer p
+    {
+        {
+            { name { "thread" } , width { 4 } } ,
+            { name { "row" } , width { 6 } , fill { '0' } } ,
+            { name { "value" } , width { 10 } , fixed {} , precision { 2 } }
+        } ,
+        ss
+    };
+
+    constexpr int threads_count { 4 };
+    constexpr int rows_count { 500 };
+
+    std::vector<std::thread> threads;
+
+    for ( int t = 0; t < threads_count; ++t )
+        threads.emplace_back(
+            [ &p , t ]
+            {
+                for ( int row = 0; row < rows_count; ++row )
+                    p.print( t , row , row / 4.0 );
+            }
+        );
+
+    for ( std::thread& t : threads )
+        t.join();
+
+    int lines {};
+    std::string line;
+
+    while ( std::getline( ss , line ) )
+    {
+        ++lines;
+
+        REQUIRE( std::size( line ) == 20 );
+    }
+
+    REQUIRE( lines == threads_count * rows_count );
+}
+
+TEST_CASE( "Options of a concurrent printer do not leak into the next row" , "[concurrent_printer]" )
+{
+    using namespace tableprinter;
+
+    std::stringstream ss;
+
+    concurrent_printer p
+    {
+        {
+            { } ,
+            { width { 6 } , fixed {} , precision { 2 } , hex {} }
+        } ,
+        ss
+    };
+
+    p.print( 0.5 , 1.0 ).print( 0.5 , 255 );
+
+    REQUIRE( ss.str() == "0.5  1.00\n0.5    ff\n" );
+}
+
+TEST_CASE( "A cell that fails to insert fails the streams but not the next rows" , "[concurrent_printer]" )
+{
+    using namespace tableprinter;
+
+    const char* missing {};
+
+    std::stringstream ss1;
+
+    printer p1
+    {
+        {
+            { width { 4 } } ,
+            { width { 4 } }
+        } ,
+        ss1
+    };
+
+    p1.render_once()
+        .print( 1 , "a" )
+        .print( 2 , missing );
+
+    REQUIRE( ss1.fail() );
+
+    ss1.clear();
+    p1.print( 3 , "b" );
+
+    REQUIRE( ss1.good() );
+    REQUIRE( ss1.str() == "   1   a\n   2\n   3   b\n" );
+
+    std::stringstream ss2;
+    std::stringstream ss3;
+
+    concurrent_printer p2 { { { width { 4 } } , { width { 4 } } } , ss2 };
+    concurrent_printer p3 { { { width { 4 } } , { width { 4 } } } , ss3 };
+
+    p2.print( 1 , missing );
+    p3.print( 2 , "c" );
+
+    REQUIRE( ss2.fail() );
+    REQUIRE( ss3.good() );
+    REQUIRE( ss3.str() == "   2   c\n" );
+}
+
+TEST_CASE( "Flushing an async printer waits for every row to be written" , "[async_printer]" )
+{
+    using namespace tableprinter;
+
+    std::stringstream ss1 , ss2;
+
+    async_printer p
+    {
+        {
+            { name { "col-1" } , width { 4 } } ,
+            { name { "col-2" } , width { 6 } , fixed {} , precision { 1 } }
+        } ,
+        { ss1 , ss2 } ,
+        queue_capacity { 4 }
+    };
+
+    p.echo( "rows :" ).print_headers();
+
+    for ( int i = 0; i < 100; ++i )
+        p.print( i , i / 2.0 );
+
+    p.flush();
+
+    std::string expected { "rows :\ncol-1 col-2\n" };
+
+    for ( int i = 0; i < 100; ++i )
+    {
+        std::stringstream row;
+        row << std::setw( 4 ) << i << std::setw( 6 ) << std::fixed << std::setprecision( 1 ) << i / 2.0 << '\n';
+        expected += row.str();
+    }
+
+    REQUIRE( ss1.str() == expected );
+    REQUIRE( ss2.str() == expected );
+    REQUIRE( p.dropped() == 0 );
+}
+
+TEST_CASE( "Flushing an async printer rethrows what a stream threw" , "[async_printer]" )
+{
+    using namespace tableprinter;
+
+    struct failing_buffer : std::streambuf
+    {
+        std::streamsize xsputn( const char* , std::streamsize ) override
+        {
+            return 0;
+        }
+    };
+
+    failing_buffer buffer;
+    std::ostream os { &buffer };
+
+    os.exceptions( std::ios_base::badbit );
+
+    async_printer p { { { } } , os };
+
+    p.print( 1 ).print( 2 );
+
+    REQUIRE_THROWS_AS( p.flush() , std::ios_base::failure );
+
+    os.clear();
+    os.exceptions( std::ios_base::goodbit );
+
+    p.print( 3 );
+
+    REQUIRE_NOTHROW( p.flush() );
+}
+
+namespace
+{
+
+// Blocks the first write until 'open' is called, so the queue of an
+// async printer can be filled deterministically.
+struct gated_buffer : std::stringbuf
+{
+    void wait_until_entered()
+    {
+        std::unique_lock lock { mutex };
+        cv.wait( lock , [ this ]{ return entered; } );
+    }
+
+    void open()
+    {
+        std::lock_guard lock { mutex };
+        opened = true;
+        cv.notify_all();
+    }
+
+    std::streamsize xsputn( const char* s , std::streamsize n ) override
+    {
+        {
+            std::unique_lock lock { mutex };
+            entered = true;
+            cv.notify_all();
+            cv.wait( lock , [ this ]{ return opened; } );
+        }
+
+        return std::stringbuf::xsputn( s , n );
+    }
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool entered {};
+    bool opened {};
+};
+
+}
+
+TEST_CASE( "Async printer applies overflow policy when the queue is full" , "[async_printer]" )
+{
+    using namespace tableprinter;
+
+    auto print_with = []( overflow_policy policy )
+    {
+        gated_buffer buffer;
+        std::ostream os { &buffer };
+
+        {
+            async_printer p
+            {
+                { { } } ,
+                os ,
+                queue_capacity { 2 } ,
+                policy
+            };
+
+            p.print( 1 );
+            buffer.wait_until_entered();
+            p.print( 2 ).print( 3 ).print( 4 );
+
+            REQUIRE( p.dropped() == 1 );
+
+            buffer.open();
+        }
+
+        return buffer.str();
+    };
+
+    REQUIRE( print_with( overflow_policy::drop_newest ) == "1\n2\n3\n" );
+    REQUIRE( print_with( overflow_policy::drop_oldest ) == "1\n3\n4\n" );
+}
+
+TEST_CASE( "Producers blocked on a full queue resume once the writer frees a slot" , "[async_printer]" )
+{
+    using namespace tableprinter;
+
+    gated_buffer buffer;
+    std::ostream os { &buffer };
+
+    async_printer p { { { } } , os , queue_capacity { 2 } };
+
+    p.print( 0 );
+    buffer.wait_until_entered();
+
+    std::vector<std::thread> producers;
+
+    for ( int i = 1; i <= 4; ++i )
+        producers.emplace_back(
+            [ &p , i ]
+            {
+                for ( int row = 0; row < 25; ++row )
+                    p.print( i );
+            }
+        );
+
+    buffer.open();
+
+    for ( auto& producer : producers )
+        producer.join();
+
+    p.flush();
+
+    const auto text { buffer.str() };
+
+    REQUIRE( p.dropped() == 0 );
+    REQUIRE( text.substr( 0 , 2 ) == "0\n" );
+
+    for ( char c : { '1' , '2' , '3' , '4' } )
+        REQUIRE( std::count( begin( text ) , end( text ) , c ) == 25 );
+}
+
+#ifdef TABLEPRINTER_POSIX
+
+TEST_CASE( "File descriptor sink writes what a stream would" , "[fd_sink]" )
+{
+    using namespace tableprinter;
+
+    int fds[ 2 ];
+    REQUIRE( ::pipe( fds ) == 0 );
+
+    std::stringstream ss;
+    std::string expected;
+
+    {
+        fd_sink sink { fds[ 1 ] , 8 };
+
+        printer p
+        {
+            {
+                { name { "id" } , width { 4 } } ,
+                { name { "label" } , width { 12 } , left() }
+            } ,
+            { ss , sink }
+        };
+
+        p.render_once();
+        p.print_headers();
+
+        for ( int i = 0 ; i < 16 ; ++i )
+            p.print( i , "row" );
+
+        expected = ss.str();
+
+        p.remove_streams( sink );
+        p.print( -1 , "only stream" );
+    }
+
+    ::close( fds[ 1 ] );
+
+    std::string written;
+    char chunk[ 256 ];
+
+    for ( ssize_t n ; ( n = ::read( fds[ 0 ] , chunk , sizeof( chunk ) ) ) > 0 ; )
+        written.append( chunk , std::size_t( n ) );
+
+    ::close( fds[ 0 ] );
+
+    REQUIRE( written == expected );
+}
+
+TEST_CASE( "Memory mapped sink truncates the file to the bytes written" , "[mmap_sink]" )
+{
+    using namespace tableprinter;
+
+    char path[] = "/tmp/tableprinter-mmap-XXXXXX";
+    const auto fd { ::mkstemp( path ) };
+    REQUIRE( fd >= 0 );
+
+    auto file_contents = [ & ]
+    {
+        std::ifstream file { path , std::ios_base::binary };
+
+        return std::string { std::istreambuf_iterator<char> { file } , std::istreambuf_iterator<char> {} };
+    };
+
+    std::stringstream ss;
+
+    {
+        mmap_sink sink { fd , 16 };
+
+        printer p
+        {
+            {
+                { name { "id" } , width { 4 } } ,
+                { name { "label" } , width { 12 } , left() }
+            } ,
+            { ss , sink }
+        };
+
+        p.render_once();
+        p.print_headers();
+
+        for ( int i = 0 ; i < 8 ; ++i )
+            p.print( i , "row" );
+
+        p.flush();
+
+        const auto flushed { file_contents() };
+
+        REQUIRE( flushed.substr( 0 , ss.str().size() ) == ss.str() );
+        REQUIRE( flushed.find_first_not_of( '\0' , ss.str().size() ) == std::string::npos );
+
+        for ( int i = 0 ; i < 1024 ; ++i )
+            p.print( i , "more rows" );
+    }
+
+    REQUIRE( file_contents() == ss.str() );
+
+    ::close( fd );
+    ::unlink( path );
+}
+
+TEST_CASE( "io_uring sink writes what a stream would" , "[uring_sink]" )
+{
+    using namespace tableprinter;
+
+    char path[] = "/tmp/tableprinter-uring-XXXXXX";
+    const auto fd { ::mkstemp( path ) };
+    REQUIRE( fd >= 0 );
+
+    std::stringstream ss;
+
+    {
+        uring_sink sink { fd , 16 , 2 };
+
+        printer p
+        {
+            {
+                { name { "id" } , width { 4 } } ,
+                { name { "label" } , width { 12 } , left() }
+            } ,
+            { ss , sink }
+        };
+
+        p.render_once();
+        p.print_headers();
+
+        for ( int i = 0 ; i < 1024 ; ++i )
+            p.print( i , "row" );
+
+        p.flush();
+        REQUIRE( sink.good() );
+    }
+
+    std::ifstream file { path , std::ios_base::binary };
+    const std::string written { std::istreambuf_iterator<char> { file } , std::istreambuf_iterator<char> {} };
+
+    REQUIRE( written == ss.str() );
+
+    ::close( fd );
+    ::unlink( path );
+}
+
+TEST_CASE( "io_uring sink falls back to plain writes for pipes" , "[uring_sink]" )
+{
+    using namespace tableprinter;
+
+    int fds[ 2 ];
+    REQUIRE( ::pipe( fds ) == 0 );
+
+    {
+        uring_sink sink { fds[ 1 ] };
+
+        REQUIRE( !sink.uses_io_uring() );
+
+        printer p { { { width { 3 } } } , sink };
+        p.print( 1 ).print( 2 );
+    }
+
+    ::close( fds[ 1 ] );
+
+    char written[ 16 ] {};
+    REQUIRE( ::read( fds[ 0 ] , written , sizeof( written ) ) == 8 );
+    REQUIRE( std::string { written } == "  1\n  2\n" );
+
+    ::close( fds[ 0 ] );
+}
+
+#endif
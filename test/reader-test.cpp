@@ -0,0 +1,528 @@
+#define CATCH_CONFIG_MAIN
+#include"catch.hpp"
+#include <cstdio>
+#include <algorithm>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+#include <tableprinter/tableprinter.hpp>
+#include <tableprinter/reader.hpp>
+
+namespace
+{
+
+const std::vector<tableprinter::column>& scores_columns()
+{
+    using namespace tableprinter;
+
+    static const std::vector<column> columns
+    {
+        { name { "id" }      , width { 4 }  , hex {} } ,
+        { name { "name" }    , width { 8 } } ,
+        { name { "surname" } , width { 10 } } ,
+        { name { "rank" }    , width { 6 } , decimal {} } ,
+        { name { "score" }   , width { 7 } , fixed { } , precision { 2 } }
+    };
+
+    return columns;
+}
+
+}
+
+TEST_CASE( "Read back the rows of a printed table" , "[reader]" )
+{
+    using namespace tableprinter;
+
+    std::stringstream ss;
+
+    printer { scores_columns() , ss }
+        .echo( "The scores are listed below with their ranks :" )
+        .print_headers()
+        .print( 5000 , "Lucy"   , "Ballmer"  , 2  , 94.13 )
+        .print( 5100 , "Roger"  , "Bacon"    , -5 , 77.13 )
+        .print( -1   , "Anna"   , "Smith"    , 3  , -87.5 );
+
+    const auto text { ss.str() };
+
+    reader r { scores_columns() , text };
+
+    r.skip_headers();
+
+    std::vector<std::tuple<int , std::string , std::string , int , float>> rows;
+
+    for ( const auto& row : r )
+        rows.push_back( row.as<int , std::string , std::string , int , float>() );
+
+    REQUIRE( rows.size() == 3 );
+    REQUIRE( rows[ 0 ] == std::make_tuple( 5000 , "Lucy" , "Ballmer" , 2 , 94.13f ) );
+    REQUIRE( rows[ 1 ] == std::make_tuple( 5100 , "Roger" , "Bacon" , -5 , 77.13f ) );
+    REQUIRE( rows[ 2 ] == std::make_tuple( -1 , "Anna" , "Smith" , 3 , -87.5f ) );
+
+    auto it { r.begin() };
+
+    REQUIRE( it->line() == 3 );
+    REQUIRE( ( *it )[ 0 ] == "1388" );
+    REQUIRE( it->get<std::string_view>( 1 ) == "Lucy" );
+    REQUIRE( ( ++it )->line() == 4 );
+    REQUIRE( ++ ++it == r.end() );
+}
+
+TEST_CASE( "Read numbers in the base left over by preceding columns" , "[reader]" )
+{
+    using namespace tableprinter;
+
+    std::stringstream ss;
+
+    const std::vector<column> columns
+    {
+        { width { 6 } } ,
+        { width { 6 } , octal {} }
+    };
+
+    printer { columns , ss }
+        .print( 255 , 255 )
+        .print( 255 , 255 );
+
+    REQUIRE( ss.str() == "   255   377\n"
+                         "   377   377\n" );
+
+    const auto text { ss.str() };
+
+    for ( const auto& row : reader { columns , text } )
+        REQUIRE( row.as<unsigned , long>() == std::make_tuple( 255u , 255l ) );
+}
+
+TEST_CASE( "Cut fixed width rows at their offsets" , "[reader]" )
+{
+    using namespace tableprinter;
+
+    std::stringstream ss;
+
+    const std::vector<column> columns
+    {
+        { name { "id" }    , width { 5 } , fill { '0' } } ,
+        { name { "name" }  , width { 12 } , fill { '.' } , left {} } ,
+        { name { "city" }  , width { 10 } , fill { ' ' } , right {} } ,
+        { name { "score" } , width { 6 } , fixed {} , precision { 1 } }
+    };
+
+    printer { columns , ss }
+        .print_headers()
+        .print( 7 , "Mary Ann" , "New York" , 1.5 )
+        .print( 0 , "Al" , "Rome" , 0.0 )
+        .print( 8 , "Jo" , "Boston" , 2.0 );
+
+    const auto text { ss.str() };
+
+    reader r { columns , text };
+
+    std::vector<std::tuple<int , std::string_view , std::string_view , double>> rows;
+
+    for ( const auto& row : r.skip_headers() )
+        rows.push_back( row.as<int , std::string_view , std::string_view , double>() );
+
+    REQUIRE( rows.size() == 3 );
+    REQUIRE( rows[ 0 ] == std::make_tuple( 7 , "Mary Ann" , "New York" , 1.5 ) );
+    REQUIRE( rows[ 1 ] == std::make_tuple( 0 , "Al" , "Rome" , 0.0 ) );
+    REQUIRE( rows[ 2 ] == std::make_tuple( 8 , "Jo" , "Boston" , 2.0 ) );
+}
+
+TEST_CASE( "Read rows printed after the headers with mixed adjustments" , "[reader]" )
+{
+    using namespace tableprinter;
+
+    const std::vector<column> spaced
+    {
+        { name { "n" } , width { 6 } } ,
+        { name { "label" } , width { 8 } , left {} }
+    };
+
+    const std::vector<column> filled
+    {
+        { name { "n" } , width { 6 } , fill { '*' } } ,
+        { name { "label" } , width { 8 } , left {} } ,
+        { name { "ratio" } , width { 7 } , fixed {} , precision { 2 } }
+    };
+
+    std::stringstream spaced_ss , filled_ss;
+
+    printer { spaced , spaced_ss }
+        .print_headers()
+        .print( 12 , "ab" )
+        .print( 345 , "cdef" );
+
+    printer { filled , filled_ss }
+        .print_headers()
+        .print( 12 , "ab" , 0.5 )
+        .print( 345 , "cdef" , 1.25 );
+
+    REQUIRE( spaced_ss.str() == "     nlabel   \n"
+                                "12    ab      \n"
+                                "345   cdef    \n" );
+
+    REQUIRE( filled_ss.str() == "     nlabel   ratio  \n"
+                                "12****ab******0.50***\n"
+                                "345***cdef****1.25***\n" );
+
+    const auto spaced_text { spaced_ss.str() };
+    const auto filled_text { filled_ss.str() };
+
+    reader spaced_r { spaced , spaced_text };
+    reader filled_r { filled , filled_text };
+
+    REQUIRE( ( spaced_r.skip_headers().read_rows<int , std::string_view>() ) ==
+             std::vector<std::tuple<int , std::string_view>> { { 12 , "ab" } , { 345 , "cdef" } } );
+
+    REQUIRE( ( filled_r.skip_headers().read_rows<int , std::string_view , double>() ) ==
+             std::vector<std::tuple<int , std::string_view , double>> { { 12 , "ab" , 0.5 } , { 345 , "cdef" , 1.25 } } );
+}
+
+TEST_CASE( "Split rows with overflowing values on whitespace" , "[reader]" )
+{
+    using namespace tableprinter;
+
+    std::stringstream ss;
+
+    const std::vector<column> columns
+    {
+        { width { 4 } } ,
+        { width { 8 } } ,
+        { width { 6 } , fixed {} , precision { 1 } }
+    };
+
+    printer { columns , ss }
+        .print( 1 , "Jo" , 1.0 )
+        .print( 123456 , "Al" , 2.0 )
+        .print( 3 , "Mary Ann" , 4.0 );
+
+    const auto text { ss.str() };
+
+    std::vector<std::tuple<int , std::string_view , double>> rows;
+
+    for ( const auto& row : reader { columns , text } )
+        rows.push_back( row.as<int , std::string_view , double>() );
+
+    REQUIRE( rows == std::vector<std::tuple<int , std::string_view , double>> {
+        { 1 , "Jo" , 1.0 } ,
+        { 123456 , "Al" , 2.0 } ,
+        { 3 , "Mary Ann" , 4.0 }
+    } );
+
+    reader overflowing { columns , "   1Mary Ann Lee   1.0\n" };
+
+    REQUIRE_THROWS_AS( overflowing.begin() , fields_size_doesnt_match_with_columns );
+}
+
+TEST_CASE( "Split long rows on any kind of blank" , "[reader]" )
+{
+    using namespace tableprinter;
+
+    const std::vector<column> columns ( 40 , column { precision { 3 } } );
+
+    std::mt19937 gen { 42 };
+    std::uniform_int_distribution<int> lengths { 1 , 70 };
+    const std::string_view blanks { " \t\v\f\r" };
+
+    std::string text;
+    std::vector<std::vector<std::string>> expected ( 50 );
+
+    for ( auto& fields : expected )
+    {
+        for ( std::size_t col {}; col < size( columns ); ++col )
+        {
+            for ( int n = lengths( gen ) % 3; n >= 0; --n )
+                text += blanks[ std::size_t( lengths( gen ) ) % size( blanks ) ];
+
+            fields.emplace_back( std::size_t( lengths( gen ) ) , char( 'a' + col % 26 ) );
+            text += fields.back();
+        }
+
+        text += lengths( gen ) % 2 ? "\r\n" : "\n";
+    }
+
+    text.pop_back();
+
+    std::size_t idx {};
+
+    for ( const auto& row : reader { columns , text } )
+    {
+        REQUIRE( row.line() == idx + 1 );
+        REQUIRE( std::vector<std::string> ( row.begin() , row.end() ) == expected[ idx++ ] );
+    }
+
+    REQUIRE( idx == size( expected ) );
+}
+
+TEST_CASE( "Split unterminated lines filling whole blocks" , "[reader]" )
+{
+    using namespace tableprinter;
+
+    const std::vector<column> free_columns { {} , {} };
+    const std::vector<column> fixed_columns { { width { 4 } } , { width { 8 } } };
+
+    for ( std::size_t length : { 64u , 128u } )
+    {
+        const std::string first ( length / 2 - 1 , 'x' );
+        const std::string second ( length / 2 , 'y' );
+        const auto text { first + ' ' + second };
+
+        REQUIRE( text.size() == length );
+
+        for ( const auto* columns : { &free_columns , &fixed_columns } )
+        {
+            std::size_t rows {};
+
+            for ( const auto& row : reader { *columns , text } )
+            {
+                REQUIRE( row.size() == 2 );
+                REQUIRE( row[ 0 ] == first );
+                REQUIRE( row[ 1 ] == second );
+
+                ++rows;
+            }
+
+            REQUIRE( rows == 1 );
+        }
+    }
+}
+
+TEST_CASE( "Parse pieces of a table on several threads" , "[reader]" )
+{
+    using namespace tableprinter;
+
+    std::stringstream ss;
+
+    const std::vector<column> columns
+    {
+        { name { "id" }    , width { 8 } } ,
+        { name { "name" }  , width { 12 } } ,
+        { name { "score" } , width { 10 } , fixed {} , precision { 2 } }
+    };
+
+    printer p { columns , ss };
+
+    p.echo( "Scores" ).print_headers();
+
+    for ( int i = 0; i < 50000; ++i )
+    {
+        if ( i % 1000 == 0 )
+            p.echo( "" );
+
+        p.print( i , "name" + std::to_string( i % 97 ) , i / 8.0 );
+    }
+
+    const auto text { ss.str() };
+
+    reader r { columns , text };
+
+    r.skip_headers();
+
+    std::vector<std::tuple<int , std::string_view , double>> expected;
+    std::vector<std::size_t> expected_lines;
+
+    for ( const auto& row : r )
+    {
+        expected.push_back( row.as<int , std::string_view , double>() );
+        expected_lines.push_back( row.line() );
+    }
+
+    REQUIRE( expected.size() == 50000 );
+    REQUIRE( std::get<0>( expected.back() ) == 49999 );
+
+    for ( unsigned threads : { 1u , 3u , 8u , 0u } )
+    {
+        REQUIRE( ( r.read_rows<int , std::string_view , double>( threads ) ) == expected );
+
+        std::mutex mutex;
+        std::vector<std::pair<std::size_t , int>> lines;
+
+        r.for_each_row(
+            [ & ]( const reader::row& row )
+            {
+                std::lock_guard<std::mutex> lock { mutex };
+
+                lines.emplace_back( row.line() , row.get<int>( 0 ) );
+            } ,
+            threads
+        );
+
+        std::sort( lines.begin() , lines.end() );
+
+        REQUIRE( lines.size() == expected.size() );
+
+        for ( std::size_t idx {}; idx < lines.size(); ++idx )
+        {
+            REQUIRE( lines[ idx ].first == expected_lines[ idx ] );
+            REQUIRE( lines[ idx ].second == std::get<0>( expected[ idx ] ) );
+        }
+    }
+
+    auto malformed { text };
+
+    malformed.insert( malformed.find( '\n' , malformed.size() * 3 / 4 ) + 1 , "   extra\n" );
+
+    REQUIRE_THROWS_AS( ( reader { columns , malformed }.skip_headers().read_rows<int , std::string_view , double>( 4 ) ) , fields_size_doesnt_match_with_columns );
+    REQUIRE( reader { columns , "" }.read_rows<int , std::string_view , double>( 4 ).empty() );
+}
+
+TEST_CASE( "Read a table into a vector per column" , "[reader]" )
+{
+    using namespace tableprinter;
+
+    std::stringstream ss;
+
+    const std::vector<column> columns
+    {
+        { name { "id" }    , width { 8 } , hex {} } ,
+        { name { "name" }  , width { 12 } } ,
+        { name { "rank" }  , width { 6 } , decimal {} } ,
+        { name { "score" } , width { 10 } , fixed {} , precision { 2 } }
+    };
+
+    printer p { columns , ss };
+
+    p.print_headers();
+
+    for ( int i = 0; i < 20000; ++i )
+        p.print( i , "name" + std::to_string( i % 97 ) , i % 100 - 50 , i / 4.0 );
+
+    const auto text { ss.str() };
+
+    reader r { columns , text };
+
+    r.skip_headers();
+
+    const auto rows { r.read_rows<int , std::string , int , float>() };
+
+    for ( unsigned threads : { 1u , 4u } )
+    {
+        const auto [ ids , names , ranks , scores ] = r.read_columns<int , std::string , int , float>( threads );
+
+        REQUIRE( ids.size() == rows.size() );
+        REQUIRE( names.size() == rows.size() );
+        REQUIRE( names.offsets().back() == names.chars().size() );
+
+        for ( std::size_t idx {}; idx < rows.size(); ++idx )
+        {
+            REQUIRE( ids[ idx ] == std::get<0>( rows[ idx ] ) );
+            REQUIRE( names[ idx ] == std::get<1>( rows[ idx ] ) );
+            REQUIRE( ranks[ idx ] == std::get<2>( rows[ idx ] ) );
+            REQUIRE( scores[ idx ] == std::get<3>( rows[ idx ] ) );
+        }
+
+        const auto id_summary { summarize( ids ) };
+
+        REQUIRE( id_summary.min == 0 );
+        REQUIRE( id_summary.max == 19999 );
+        REQUIRE( id_summary.sum == 19999LL * 20000 / 2 );
+        REQUIRE( id_summary.count == 20000 );
+
+        const auto rank_summary { summarize( ranks ) };
+
+        REQUIRE( rank_summary.min == -50 );
+        REQUIRE( rank_summary.max == 49 );
+        REQUIRE( rank_summary.sum == -10000 );
+
+        const auto score_summary { summarize( scores ) };
+
+        REQUIRE( score_summary.min == 0.0f );
+        REQUIRE( score_summary.max == 19999 / 4.0f );
+        REQUIRE( score_summary.sum == Approx( 19999.0 * 20000 / 8 ) );
+    }
+
+    const auto [ views ] = reader { { { width { 4 } } } , "  ab\n  cd" }.read_columns<std::string_view>();
+
+    REQUIRE( views == std::vector<std::string_view> { "ab" , "cd" } );
+    REQUIRE_THROWS_AS( ( r.read_columns<int , std::string>() ) , arguments_size_doesnt_match_with_columns );
+
+    const auto odd { summarize( std::vector<short> { 3 , -1 , 7 , 2 , 9 , -4 , 0 , 5 , 8 , -6 , 1 } ) };
+
+    REQUIRE( odd.min == -6 );
+    REQUIRE( odd.max == 9 );
+    REQUIRE( odd.sum == 24 );
+
+    const auto empty { summarize( std::vector<double> {} ) };
+
+    REQUIRE( empty.count == 0 );
+    REQUIRE( empty.sum == 0.0 );
+    REQUIRE( empty.min > empty.max );
+}
+
+TEST_CASE( "Skip lines and blank lines" , "[reader]" )
+{
+    using namespace tableprinter;
+
+    const std::vector<column> columns { { width { 4 } } , { width { 8 } } };
+
+    reader r { columns , "first echo\r\nsecond echo\r\n\r\n   1     0.5\r\n\n   2    0.25" };
+
+    r.skip_lines( 2 );
+
+    std::vector<std::pair<int , double>> rows;
+
+    for ( const auto& row : r )
+        rows.emplace_back( row.get<int>( 0 ) , row.get<double>( 1 ) );
+
+    REQUIRE( rows == std::vector<std::pair<int , double>> { { 1 , 0.5 } , { 2 , 0.25 } } );
+    REQUIRE( reader { columns , "" }.begin() == reader { columns , "" }.end() );
+}
+
+TEST_CASE( "Reader rejects malformed tables" , "[reader]" )
+{
+    using namespace tableprinter;
+
+    const std::vector<column> columns { { name { "id" } , width { 4 } } , { name { "score" } , width { 8 } } };
+
+    REQUIRE_THROWS_AS( ++reader ( columns , "   1     0.5\n   2\n" ).begin() , fields_size_doesnt_match_with_columns );
+    REQUIRE_THROWS_AS( reader ( columns , "id score\n" ).skip_headers().begin() , header_not_found );
+
+    reader r { columns , "  id   score\n  1x     0.5\n" };
+
+    auto it { r.skip_headers().begin() };
+
+    REQUIRE( it->line() == 2 );
+    REQUIRE_THROWS_AS( it->get<int>( 0 ) , invalid_field );
+    REQUIRE_THROWS_AS( ( it->as<int , double , int>() ) , arguments_size_doesnt_match_with_columns );
+    REQUIRE( it->get<double>( 1 ) == 0.5 );
+}
+
+TEST_CASE( "Read a printed file through a mapping" , "[reader]" )
+{
+    using namespace tableprinter;
+
+    const char* path { "reader-test-scores.txt" };
+
+    {
+        std::ofstream file { path };
+
+        printer p { scores_columns() , file };
+
+        p.print_headers();
+
+        for ( int i = 0; i < 1000; ++i )
+            p.print( i , "name" , "surname" , i % 7 , i / 4.0 );
+    }
+
+    int count {};
+    double sum {};
+
+    reader r { scores_columns() , mapped_file { path } };
+
+    for ( const auto& row : r.skip_headers() )
+    {
+        REQUIRE( row.get<int>( 0 ) == count++ );
+        sum += row.get<double>( 4 );
+    }
+
+    std::remove( path );
+
+    REQUIRE( count == 1000 );
+    REQUIRE( sum == Approx( 999 * 1000 / 8.0 ) );
+    REQUIRE_THROWS_AS( mapped_file { path } , file_could_not_be_read );
+    REQUIRE( mapped_file {}.view().empty() );
+}